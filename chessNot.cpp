@@ -3,12 +3,43 @@
 #include <stack>
 #include <set>
 #include <map>
+#include <unordered_map>
 #include <memory>
 #include <sstream>
-#include <stdexcept> 
+#include <string_view>
+#include <stdexcept>
 #include <cctype>
+#include <climits>
+#include <cstring>
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+#endif
 #include <algorithm>
 #include <fstream>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// Optional ahead-of-time DFA tables: run `chessNot --emit-tables` once to
+// generate chessNotTables.h, then rebuild with -DCHESSNOT_PRECOMPILED_TABLES
+// so ChessLexer construction just copies constexpr tables out of read-only
+// pages instead of re-running NFA construction and subset construction.
+#ifdef CHESSNOT_PRECOMPILED_TABLES
+#include "chessNotTables.h"
+#endif
 
 using namespace std;
 
@@ -29,350 +60,869 @@ enum class ChessTokenType {
     RESULT,
     VAR_BEGIN,
     VAR_END,
+    COMMENT,
+    NAG,
+    ANNOTATION,
+    NULL_MOVE,
     END_OF_INPUT,
     INVALID
 };
 
-// Chess token structure
+// ========== WHITESPACE PRESCAN ==========
+// Branch-light whitespace handling for the scanner loop. The scalar helper
+// replaces the locale-aware isspace call; on SSE2 targets runs of whitespace
+// are skipped 16 bytes at a time, falling back to scalar near the end of the
+// buffer.
+inline bool isPgnWhitespace(char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r');  // \t \n \v \f \r
+}
+
+inline int skipWhitespace(string_view input, int pos) {
+    int length = (int)input.length();
+
+#ifdef __SSE2__
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i ctrlSpan = _mm_set1_epi8('\r' - '\t');  // \t..\r as one range
+
+    while (pos + 16 <= length) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(input.data() + pos));
+        // whitespace = (c == ' ') || ((unsigned)(c - '\t') <= '\r' - '\t')
+        __m128i isSpace = _mm_cmpeq_epi8(chunk, space);
+        __m128i shifted = _mm_sub_epi8(chunk, tab);
+        __m128i isCtrl = _mm_cmpeq_epi8(_mm_min_epu8(shifted, ctrlSpan), shifted);
+        int mask = _mm_movemask_epi8(_mm_or_si128(isSpace, isCtrl));
+        if (mask != 0xFFFF) {
+            return pos + __builtin_ctz(~mask);
+        }
+        pos += 16;
+    }
+#endif
+
+    while (pos < length && isPgnWhitespace(input[pos])) {
+        pos++;
+    }
+    return pos;
+}
+
+// Chess token structure. The value is a view into the input buffer (no copy,
+// no allocation); the buffer must outlive the token stream, which every
+// driver in this file guarantees by keeping the game text alive while its
+// tokens are processed.
 struct ChessToken {
     ChessTokenType type;
-    string value;
+    string_view value;
+    int position;
+
+    ChessToken(ChessTokenType t, string_view v, int pos) : type(t), value(v), position(pos) {}
+};
+
+// ========== SOA TOKEN STREAM ==========
+// Structure-of-arrays token layout: parallel type/offset/length arrays
+// instead of a vector of ChessToken. The validator mostly reads types, so a
+// type-only scan touches one byte per token instead of a whole interleaved
+// struct, and the contiguous uint8 type array is directly usable for SIMD
+// classification. Lengths are clamped to 255 — only COMMENT and recovered
+// INVALID spans can exceed that, and neither is ever length-checked or
+// re-parsed downstream.
+struct TokenStream {
+    vector<uint8_t> types;
+    vector<uint32_t> offsets;
+    vector<uint8_t> lengths;
+
+    size_t size() const {
+        return types.size();
+    }
+
+    void clear() {
+        types.clear();
+        offsets.clear();
+        lengths.clear();
+    }
+
+    void push(ChessTokenType type, uint32_t offset, size_t length) {
+        types.push_back((uint8_t)type);
+        offsets.push_back(offset);
+        lengths.push_back(length > 255 ? (uint8_t)255 : (uint8_t)length);
+    }
+
+    // Reconstructs the AoS view of one token; the value points back into
+    // the original input buffer.
+    ChessToken get(size_t i, string_view input) const {
+        return ChessToken((ChessTokenType)types[i],
+                          input.substr(offsets[i], lengths[i]),
+                          (int)offsets[i]);
+    }
+};
+
+// ========== VALIDATION REPORT ==========
+// Machine-readable outcome of analyzing one game: counts, compact error
+// codes and positions. All pretty-printing is layered on top of this and is
+// opt-in, so batch jobs get results at full speed with no iostream traffic.
+enum class ValidationErrorCode {
+    INVALID_TOKEN,            // lexer could not match any token
+    TOKENS_TOUCHING,          // two primary moves with no separator
+    UNMATCHED_VAR_END,        // ')' without a matching '('
+    UNCLOSED_VARIATION,       // '(' without a matching ')'
+    MISSING_RESULT,           // input ended before a game result
+    TOKENS_AFTER_RESULT,      // trailing tokens after game termination
+    RESULT_AFTER_MOVE_NUMBER, // result directly after a move number
+    UNEXPECTED_MOVE_NUMBER,   // move number where a move/result was expected
+    WRONG_MOVE_NUMBER,        // move number out of sequence
+    BAD_MOVE_NUMBER_VALUE,    // move number failed to parse
+    CHECKMATE_WITHOUT_RESULT, // mate not followed by a result
+    UNEXPECTED_MOVE           // move where a move number/result was expected
+};
+
+inline const char* validationErrorCodeName(ValidationErrorCode code) {
+    switch (code) {
+        case ValidationErrorCode::INVALID_TOKEN:            return "INVALID_TOKEN";
+        case ValidationErrorCode::TOKENS_TOUCHING:          return "TOKENS_TOUCHING";
+        case ValidationErrorCode::UNMATCHED_VAR_END:        return "UNMATCHED_VAR_END";
+        case ValidationErrorCode::UNCLOSED_VARIATION:       return "UNCLOSED_VARIATION";
+        case ValidationErrorCode::MISSING_RESULT:           return "MISSING_RESULT";
+        case ValidationErrorCode::TOKENS_AFTER_RESULT:      return "TOKENS_AFTER_RESULT";
+        case ValidationErrorCode::RESULT_AFTER_MOVE_NUMBER: return "RESULT_AFTER_MOVE_NUMBER";
+        case ValidationErrorCode::UNEXPECTED_MOVE_NUMBER:   return "UNEXPECTED_MOVE_NUMBER";
+        case ValidationErrorCode::WRONG_MOVE_NUMBER:        return "WRONG_MOVE_NUMBER";
+        case ValidationErrorCode::BAD_MOVE_NUMBER_VALUE:    return "BAD_MOVE_NUMBER_VALUE";
+        case ValidationErrorCode::CHECKMATE_WITHOUT_RESULT: return "CHECKMATE_WITHOUT_RESULT";
+        case ValidationErrorCode::UNEXPECTED_MOVE:          return "UNEXPECTED_MOVE";
+    }
+    return "UNKNOWN";
+}
+
+// One past the last code, for histogram arrays indexed by (int)code.
+constexpr int VALIDATION_ERROR_CODE_COUNT = (int)ValidationErrorCode::UNEXPECTED_MOVE + 1;
+
+struct ValidationError {
+    ValidationErrorCode code;
     int position;
+};
 
-    ChessToken(ChessTokenType t, const string& v, int pos) : type(t), value(v), position(pos) {}
+struct ValidationReport {
+    // Recovery mode stops recording after this many errors per game and
+    // flips errorsTruncated instead, so a corrupt game costs O(cap) rather
+    // than O(garbage bytes) in diagnostics.
+    static const size_t RECOVERY_ERROR_CAP = 16;
+
+    size_t tokenCount;
+    bool lexicalValid;
+    bool syntaxValid;
+    bool errorsTruncated;
+    vector<ValidationError> errors;
+
+#ifdef CHESSNOT_STATS
+    // Snapshot of this thread's counters, taken when the report is filled.
+    struct StatsSnapshot {
+        uint64_t dfaSteps;
+        uint64_t backtrackBytes;
+        uint64_t pdaHighWater;
+        StatsSnapshot() : dfaSteps(0), backtrackBytes(0), pdaHighWater(0) {}
+    } stats;
+#endif
+
+    ValidationReport() : tokenCount(0), lexicalValid(true), syntaxValid(true),
+                         errorsTruncated(false) {}
+
+    bool valid() const {
+        return lexicalValid && syntaxValid;
+    }
+};
+
+// ========== INSTRUMENTATION ==========
+// Optional hot-path counters, compiled in with -DCHESSNOT_STATS and absent
+// from release builds: every site below sits behind the CHESSNOT_STAT macro,
+// which expands to nothing when the flag is off. Counters are thread_local
+// so pipeline/parallel workers never contend on them.
+#ifdef CHESSNOT_STATS
+struct ChessNotStats {
+    static const int NUM_TOKEN_TYPES = (int)ChessTokenType::INVALID + 1;
+
+    uint64_t tokensPerType[NUM_TOKEN_TYPES];
+    uint64_t dfaSteps;          // transitions taken across all automata
+    uint64_t backtrackBytes;    // bytes scanned past the last accept
+    uint64_t pdaHighWater;      // deepest variation nesting seen
+
+    ChessNotStats() { reset(); }
+
+    void reset() {
+        for (int i = 0; i < NUM_TOKEN_TYPES; i++) tokensPerType[i] = 0;
+        dfaSteps = 0;
+        backtrackBytes = 0;
+        pdaHighWater = 0;
+    }
+
+    void print(ostream& out) const {
+        static const char* typeNames[NUM_TOKEN_TYPES] = {
+            "MOVE_NUMBER", "PAWN_MOVE", "PIECE_MOVE", "TWIN_PIECE_MOVE",
+            "PAWN_CAPTURE", "PIECE_CAPTURE", "TWIN_PIECE_CAPTURE", "CASTLING",
+            "PROMOTION", "PROMOTION_VIA_CAPTURE", "CHECK", "CHECKMATE",
+            "RESULT", "VAR_BEGIN", "VAR_END", "COMMENT", "NAG", "ANNOTATION",
+            "NULL_MOVE", "END_OF_INPUT", "INVALID",
+        };
+        out << "\n=== CHESSNOT STATS (this thread) ===\n";
+        for (int i = 0; i < NUM_TOKEN_TYPES; i++) {
+            if (tokensPerType[i] > 0) {
+                out << "  " << typeNames[i] << ": " << tokensPerType[i] << "\n";
+            }
+        }
+        out << "  DFA steps:           " << dfaSteps << "\n";
+        out << "  Backtrack bytes:     " << backtrackBytes << "\n";
+        out << "  PDA depth high-water: " << pdaHighWater << "\n";
+    }
 };
 
+inline thread_local ChessNotStats tlsStats;
+
+#define CHESSNOT_STAT(expr) ((void)(expr))
+#else
+#define CHESSNOT_STAT(expr) ((void)0)
+#endif
+
 // ========== NFA/DFA STRUCTURES ==========
+// NFA states live in one contiguous arena (the states vector owned by
+// ChessNFA) and refer to each other by int32_t index, so construction does
+// one allocation per transition list instead of one shared_ptr control block
+// per state, and closure computation works on dense integer sets.
 struct State {
-    int id;
-    map<char, vector<shared_ptr<State>>> transitions;
+    int32_t id;
+    map<char, vector<int32_t>> transitions;  // target state indices; '\0' is epsilon
     bool isFinal;
-    State(int id) : id(id), isFinal(false) {}
+    // Tag carried by accepting states of the merged master NFA: which token
+    // this accept belongs to, and its priority for same-length ties (lower
+    // wins, mirroring the old attempt order in tryMatchLongest).
+    ChessTokenType acceptType;
+    int acceptPriority;
+    explicit State(int32_t id) : id(id), isFinal(false), acceptType(ChessTokenType::INVALID), acceptPriority(INT_MAX) {}
 };
 
 struct NFAPtr {
-    shared_ptr<State> start;
-    shared_ptr<State> end;
+    int32_t start;
+    int32_t end;
+};
+
+// Dynamic bitvector over NFA state ids. Subset construction manipulates
+// these instead of set<int32_t>: membership is a bit test, merging a state's
+// epsilon closure is a word-wise OR, and the DFA state map hashes the raw
+// words instead of comparing ordered sets element by element.
+struct StateBitset {
+    vector<uint64_t> words;
+
+    explicit StateBitset(size_t numStates = 0) : words((numStates + 63) / 64, 0) {}
+
+    void set(int32_t i) {
+        words[i >> 6] |= 1ull << (i & 63);
+    }
+
+    bool test(int32_t i) const {
+        return (words[i >> 6] >> (i & 63)) & 1;
+    }
+
+    // OR-in another set; returns true if any new bit appeared.
+    bool orWith(const StateBitset& other) {
+        bool changed = false;
+        for (size_t w = 0; w < words.size(); w++) {
+            uint64_t merged = words[w] | other.words[w];
+            if (merged != words[w]) {
+                words[w] = merged;
+                changed = true;
+            }
+        }
+        return changed;
+    }
+
+    bool any() const {
+        for (uint64_t w : words) if (w) return true;
+        return false;
+    }
+
+    bool operator==(const StateBitset& other) const {
+        return words == other.words;
+    }
+
+    // Visits members in ascending id order (same order a set<int32_t> gave).
+    template <typename Fn>
+    void forEach(Fn fn) const {
+        for (size_t w = 0; w < words.size(); w++) {
+            uint64_t bits = words[w];
+            while (bits) {
+                int bit = __builtin_ctzll(bits);
+                fn((int32_t)(w * 64 + bit));
+                bits &= bits - 1;
+            }
+        }
+    }
+};
+
+struct StateBitsetHash {
+    size_t operator()(const StateBitset& bitset) const {
+        size_t h = 1469598103934665603ull;  // FNV-1a
+        for (uint64_t w : bitset.words) {
+            h ^= w;
+            h *= 1099511628211ull;
+        }
+        return h;
+    }
 };
 
 struct DFAState {
     int id;
-    set<shared_ptr<State>> nfaStates;
+    StateBitset nfaStates;
     map<char, shared_ptr<DFAState>> transitions;
     bool isFinal;
-    DFAState(int id, const set<shared_ptr<State>>& states)
-        : id(id), nfaStates(states), isFinal(false) {}
+    ChessTokenType acceptType;
+    int acceptPriority;
+    DFAState(int id, const StateBitset& states)
+        : id(id), nfaStates(states), isFinal(false),
+          acceptType(ChessTokenType::INVALID), acceptPriority(INT_MAX) {}
+};
+
+// Compiled (flattened) DFA: the pointer graph produced by convertToDFA is
+// rewritten into one contiguous transition table, so the match loop does a
+// single indexed load per input byte instead of a map lookup through
+// shared_ptr nodes. -1 marks the dead state. Rows are indexed by alphabet
+// equivalence class, not raw byte: byteClass folds the 256 input bytes into
+// the classes the automaton actually distinguishes (identity until
+// compressAlphabet runs), shrinking each row from 256 entries to numClasses.
+struct CompiledDFA {
+    int numStates;
+    int numClasses;               // row width; 256 until alphabet compression
+    vector<uint8_t> byteClass;    // 256-entry byte -> equivalence class map
+    vector<int16_t> transitions;  // numStates * numClasses entries
+    vector<bool> accepting;       // one flag per state, state 0 is the start
+    vector<int16_t> acceptTag;    // (int)ChessTokenType per accepting state, -1 otherwise
+
+    CompiledDFA() : numStates(0), numClasses(256), byteClass(256) {
+        for (int c = 0; c < 256; c++) byteClass[c] = (uint8_t)c;
+    }
+
+    int16_t next(int state, unsigned char c) const {
+        return transitions[state * numClasses + byteClass[c]];
+    }
+
+    bool isAccepting(int state) const {
+        return accepting[state];
+    }
+
+    int16_t tagOf(int state) const {
+        return acceptTag[state];
+    }
 };
 
+// Grammar profiles: SAN is the classic short algebraic grammar, LAN the
+// long-algebraic form engine archives emit (e2-e4, Ng1xf3) plus null moves
+// (--, Z0), COMBINED accepts both. The profile selects which token set the
+// merged master automaton is built from; the per-token debug DFAs stay SAN.
+enum class GrammarProfile { SAN, LAN, COMBINED };
+
 class ChessNFA {
 private:
-    vector<shared_ptr<State>> states;
-    int stateCounter;
+    vector<State> states;  // the arena: state id == index
 
 public:
-    ChessNFA() : stateCounter(0) {}
+    ChessNFA() {}
 
-    shared_ptr<State> createState() {
-        auto state = make_shared<State>(stateCounter++);
-        states.push_back(state);
-        return state;
+    int32_t createState() {
+        states.emplace_back((int32_t)states.size());
+        return states.back().id;
     }
 
     NFAPtr createCharNFA(char c) {
-        auto start = createState();
-        auto end = createState();
-        start->transitions[c].push_back(end);
-        end->isFinal = true;
+        int32_t start = createState();
+        int32_t end = createState();
+        states[start].transitions[c].push_back(end);
+        states[end].isFinal = true;
         return {start, end};
     }
 
     NFAPtr createCharClassNFA(const string& charClass) {
-        auto start = createState();
-        auto end = createState();
+        int32_t start = createState();
+        int32_t end = createState();
 
         set<char> validChars;
         parseCharacterClass(charClass, validChars);
 
         for (char c : validChars) {
-            start->transitions[c].push_back(end);
+            states[start].transitions[c].push_back(end);
         }
 
-        end->isFinal = true;
+        states[end].isFinal = true;
         return {start, end};
     }
 
     NFAPtr concatenate(NFAPtr a, NFAPtr b) {
-        a.end->transitions['\0'].push_back(b.start);
-        a.end->isFinal = false;
+        states[a.end].transitions['\0'].push_back(b.start);
+        states[a.end].isFinal = false;
         return {a.start, b.end};
     }
 
     NFAPtr unionNFA(NFAPtr a, NFAPtr b) {
-        auto start = createState();
-        auto end = createState();
+        int32_t start = createState();
+        int32_t end = createState();
 
-        start->transitions['\0'].push_back(a.start);
-        start->transitions['\0'].push_back(b.start);
+        states[start].transitions['\0'].push_back(a.start);
+        states[start].transitions['\0'].push_back(b.start);
 
-        a.end->transitions['\0'].push_back(end);
-        b.end->transitions['\0'].push_back(end);
+        states[a.end].transitions['\0'].push_back(end);
+        states[b.end].transitions['\0'].push_back(end);
 
-        a.end->isFinal = false;
-        b.end->isFinal = false;
-        end->isFinal = true;
+        states[a.end].isFinal = false;
+        states[b.end].isFinal = false;
+        states[end].isFinal = true;
 
         return {start, end};
     }
 
-    NFAPtr createMoveNumberNFA() {
-        NFAPtr digit1 = createCharClassNFA("[0-9]");
-        NFAPtr oneOrMoreDigits1 = oneOrMore(digit1);
-        NFAPtr dot1 = createCharNFA('.');
+    // ---- Pattern combinator DSL ----
+    // Declarative layer over the raw arena primitives: lit/cls build leaves,
+    // seq/alt/plus combine them, so each token grammar below reads like the
+    // regular expression it implements instead of a page of createCharNFA
+    // plumbing. Construction still happens at lexer init (and is free in
+    // CHESSNOT_PRECOMPILED_TABLES builds, which skip it entirely), so the
+    // DSL costs nothing where it matters while making the grammar cheap to
+    // extend.
+    NFAPtr lit(char c) {
+        return createCharNFA(c);
+    }
+
+    NFAPtr lit(const char* text) {
+        NFAPtr result = createCharNFA(text[0]);
+        for (size_t i = 1; text[i] != '\0'; i++) {
+            result = concatenate(result, createCharNFA(text[i]));
+        }
+        return result;
+    }
 
-        NFAPtr digit2 = createCharClassNFA("[0-9]");
-        NFAPtr oneOrMoreDigits2 = oneOrMore(digit2);
-        NFAPtr dot2 = createCharNFA('.');
-        NFAPtr dot3 = createCharNFA('.');
-        NFAPtr dot4 = createCharNFA('.');
-        NFAPtr dots = concatenate(dot2, concatenate(dot3, dot4));
+    NFAPtr cls(const string& charClass) {
+        return createCharClassNFA(charClass);
+    }
 
-        NFAPtr moveNumber1 = concatenate(oneOrMoreDigits1, dot1); // 1., 23.
-        NFAPtr moveNumber2 = concatenate(oneOrMoreDigits2, dots);
+    NFAPtr seq(NFAPtr a, NFAPtr b) {
+        return concatenate(a, b);
+    }
 
-        return unionNFA(moveNumber1, moveNumber2);
+    template <typename... Rest>
+    NFAPtr seq(NFAPtr a, NFAPtr b, Rest... rest) {
+        return seq(concatenate(a, b), rest...);
     }
 
-    NFAPtr createPawnMoveNFA() {
-        NFAPtr alphabet = createCharClassNFA("[a-h]");
-        NFAPtr number = createCharClassNFA("[1-8]");
-        return concatenate(alphabet, number); // e4, d5
+    NFAPtr alt(NFAPtr a, NFAPtr b) {
+        return unionNFA(a, b);
     }
 
-    NFAPtr createPieceMoveNFA() {
-        NFAPtr alphabet = createCharClassNFA("[a-h]");
-        NFAPtr number = createCharClassNFA("[1-8]");
-        NFAPtr square = concatenate(alphabet, number);
+    template <typename... Rest>
+    NFAPtr alt(NFAPtr a, NFAPtr b, Rest... rest) {
+        return alt(unionNFA(a, b), rest...);
+    }
 
-        NFAPtr piece = createCharClassNFA("[KQRBN]");
-        return concatenate(piece, square); // Nf3, Bb5
+    NFAPtr plus(NFAPtr a) {
+        return oneOrMore(a);
     }
 
-    NFAPtr createTwinPieceMoveNFA() {
-        NFAPtr alphabet = createCharClassNFA("[a-h]");
-        NFAPtr number = createCharClassNFA("[1-8]");
-        NFAPtr square = concatenate(alphabet, number);
+    // ---- Token grammars ----
+    NFAPtr createMoveNumberNFA() {
+        return alt(seq(plus(cls("[0-9]")), lit('.')),
+                   seq(plus(cls("[0-9]")), lit("..."))); // 1., 23., 5...
+    }
+
+    NFAPtr createPawnMoveNFA() {
+        return seq(cls("[a-h]"), cls("[1-8]")); // e4, d5
+    }
 
-        NFAPtr file = createCharClassNFA("[a-h]");
-        NFAPtr rank = createCharClassNFA("[1-8]");
-        NFAPtr fileOrRank = unionNFA(file, rank);
+    NFAPtr createPieceMoveNFA() {
+        return seq(cls("[KQRBN]"), cls("[a-h]"), cls("[1-8]")); // Nf3, Bb5
+    }
 
-        NFAPtr piece = createCharClassNFA("[QRBN]");
-        NFAPtr pieceWithFileOrRank = concatenate(piece, fileOrRank);
-        return concatenate(pieceWithFileOrRank, square); // Nbd2, R1e4
+    NFAPtr createTwinPieceMoveNFA() {
+        return seq(cls("[QRBN]"), alt(cls("[a-h]"), cls("[1-8]")),
+                   cls("[a-h]"), cls("[1-8]")); // Nbd2, R1e4
     }
 
     NFAPtr createPawnCaptureNFA() {
-        NFAPtr alphabet = createCharClassNFA("[a-h]");
-        NFAPtr number = createCharClassNFA("[1-8]");
-        NFAPtr square = concatenate(alphabet, number);
-
-        NFAPtr pawn = createCharClassNFA("[a-h]");
-        NFAPtr capture = createCharNFA('x');
-        return concatenate(pawn, concatenate(capture, square)); // exd5, bxc6
+        return seq(cls("[a-h]"), lit('x'), cls("[a-h]"), cls("[1-8]")); // exd5, bxc6
     }
 
     NFAPtr createPieceCaptureNFA() {
-        NFAPtr alphabet = createCharClassNFA("[a-h]");
-        NFAPtr number = createCharClassNFA("[1-8]");
-        NFAPtr square = concatenate(alphabet, number);
-
-        NFAPtr piece = createCharClassNFA("[KQRBN]");
-        NFAPtr capture = createCharNFA('x');
-        return concatenate(piece, concatenate(capture, square)); // Nxd5, Bxe4
+        return seq(cls("[KQRBN]"), lit('x'), cls("[a-h]"), cls("[1-8]")); // Nxd5, Bxe4
     }
 
     NFAPtr createTwinPieceCaptureNFA() {
-        NFAPtr alphabet = createCharClassNFA("[a-h]");
-        NFAPtr number = createCharClassNFA("[1-8]");
-        NFAPtr square = concatenate(alphabet, number);
-
-        NFAPtr file = createCharClassNFA("[a-h]");
-        NFAPtr rank = createCharClassNFA("[1-8]");
-        NFAPtr fileOrRank = unionNFA(file, rank);
-
-        NFAPtr piece = createCharClassNFA("[QRBN]");
-        NFAPtr pieceWithFileOrRank = concatenate(piece, fileOrRank);
-        NFAPtr capture = createCharNFA('x');
-        return concatenate(pieceWithFileOrRank, concatenate(capture, square)); // Raxd5, N1xe4
+        return seq(cls("[QRBN]"), alt(cls("[a-h]"), cls("[1-8]")),
+                   lit('x'), cls("[a-h]"), cls("[1-8]")); // Raxd5, N1xe4
     }
 
     NFAPtr createCastlingNFA() {
-        NFAPtr o1 = createCharNFA('O');
-        NFAPtr dash1 = createCharNFA('-');
-        NFAPtr o2 = createCharNFA('O');
-        NFAPtr kingside = concatenate(o1, concatenate(dash1, o2));
-
-        NFAPtr o3 = createCharNFA('O');
-        NFAPtr dash2 = createCharNFA('-');
-        NFAPtr o4 = createCharNFA('O');
-        NFAPtr dash3 = createCharNFA('-');
-        NFAPtr o5 = createCharNFA('O');
-        NFAPtr queenside = concatenate(o3, concatenate(dash2, concatenate(o4, concatenate(dash3, o5))));
-        return unionNFA(kingside, queenside);
+        return alt(lit("O-O"), lit("O-O-O"));
     }
 
     NFAPtr createPromotionNFA() {
-        NFAPtr alphabet = createCharClassNFA("[a-h]");
-        NFAPtr flrank = createCharClassNFA("[18]");
-
-        NFAPtr pawn = concatenate(alphabet, flrank);
-        NFAPtr promote = createCharNFA('=');
-        NFAPtr pieceToPromote = createCharClassNFA("[QRBN]");
-        return concatenate(pawn, concatenate(promote, pieceToPromote)); // e8=Q, d1=N
+        return seq(cls("[a-h]"), cls("[18]"), lit('='), cls("[QRBN]")); // e8=Q, d1=N
     }
 
     NFAPtr createPromotionViaCaptureNFA() {
-        NFAPtr alphabet = createCharClassNFA("[a-h]");
-        NFAPtr flrank = createCharClassNFA("[18]");
-        NFAPtr sqaure = concatenate(alphabet, flrank);
-
-        NFAPtr pawn = createCharClassNFA("[a-h]");
-        NFAPtr capture = createCharNFA('x');
-        NFAPtr promote = createCharNFA('=');
-        NFAPtr pieceToPromote = createCharClassNFA("[QRBN]");
-        return concatenate(pawn, concatenate(capture, concatenate(sqaure, concatenate(promote, pieceToPromote)))); // exd8=Q
+        return seq(cls("[a-h]"), lit('x'), cls("[a-h]"), cls("[18]"),
+                   lit('='), cls("[QRBN]")); // exd8=Q
     }
 
     NFAPtr createBaseMovesNFA() {
-        return unionNFA(createPawnMoveNFA(),
-               unionNFA(createPieceMoveNFA(),
-               unionNFA(createTwinPieceMoveNFA(),
-               unionNFA(createPawnCaptureNFA(),
-               unionNFA(createPieceCaptureNFA(),
-               unionNFA(createTwinPieceCaptureNFA(),
-               unionNFA(createCastlingNFA(),
-               unionNFA(createPromotionNFA(),
-                        createPromotionViaCaptureNFA()))))))));
+        return alt(createPawnMoveNFA(), createPieceMoveNFA(),
+                   createTwinPieceMoveNFA(), createPawnCaptureNFA(),
+                   createPieceCaptureNFA(), createTwinPieceCaptureNFA(),
+                   createCastlingNFA(), createPromotionNFA(),
+                   createPromotionViaCaptureNFA());
     }
 
     NFAPtr createCheckNFA() {
-        NFAPtr moves = createBaseMovesNFA();
-        NFAPtr check = createCharNFA('+');
-        return concatenate(moves, check); // e4+, Nf3+
+        return seq(createBaseMovesNFA(), lit('+')); // e4+, Nf3+
     }
 
     NFAPtr createCheckmateNFA() {
-        NFAPtr moves = createBaseMovesNFA();
-        NFAPtr checkmate = createCharNFA('#');
-        return concatenate(moves, checkmate); // e4#, Nf3#
+        return seq(createBaseMovesNFA(), lit('#')); // e4#, Nf3#
     }
 
     NFAPtr createResultNFA() {
-        NFAPtr zero1 = createCharNFA('0');
-        NFAPtr one1 = createCharNFA('1');
-        NFAPtr dash1 = createCharNFA('-');
-        NFAPtr whiteWins = concatenate(one1, concatenate(dash1, zero1));
+        return alt(lit("1-0"), lit("0-1"), lit("1/2-1/2"));
+    }
+
+    NFAPtr createVarBeginNFA() {
+        return lit('(');
+    }
 
-        NFAPtr zero2 = createCharNFA('0');
-        NFAPtr one2 = createCharNFA('1');
-        NFAPtr dash2 = createCharNFA('-');
-        NFAPtr blackWins = concatenate(zero2, concatenate(dash2, one2));
+    NFAPtr createVarEndNFA() {
+        return lit(')');
+    }
 
-        NFAPtr simpleResults = unionNFA(whiteWins, blackWins);
+    NFAPtr createNagNFA() {
+        return seq(lit('$'), plus(cls("[0-9]"))); // $1, $14, $132
+    }
 
-        NFAPtr half1 = createCharNFA('1');
-        NFAPtr slash1 = createCharNFA('/');
-        NFAPtr two1 = createCharNFA('2');
-        NFAPtr dash3 = createCharNFA('-');
-        NFAPtr half2 = createCharNFA('1');
-        NFAPtr slash2 = createCharNFA('/');
-        NFAPtr two2 = createCharNFA('2');
+    NFAPtr createAnnotationNFA() {
+        return alt(cls("[!?]"),
+                   seq(cls("[!?]"), cls("[!?]"))); // !, ?, !!, ??, !?, ?!
+    }
 
-        NFAPtr draw = concatenate(half1, concatenate(slash1, concatenate(two1,
-                            concatenate(dash3, concatenate(half2, concatenate(slash2, two2))))));
-        return unionNFA(simpleResults, draw); //1-0 (white wins), 0-1 (black wins), 1/2-1/2 (draw)
+    // ---- Long-algebraic (LAN) grammars ----
+    NFAPtr createLanPawnMoveNFA() {
+        return seq(cls("[a-h]"), cls("[1-8]"), lit('-'),
+                   cls("[a-h]"), cls("[1-8]")); // e2-e4
     }
 
-    NFAPtr createVarBeginNFA() {
-        return createCharNFA('(');
+    NFAPtr createLanPawnCaptureNFA() {
+        return seq(cls("[a-h]"), cls("[1-8]"), lit('x'),
+                   cls("[a-h]"), cls("[1-8]")); // e4xd5
     }
 
-    NFAPtr createVarEndNFA() {
-        return createCharNFA(')');
-    }
-
-    void epsilonClosure(const set<shared_ptr<State>>& states, set<shared_ptr<State>>& closure) {
-        stack<shared_ptr<State>> stack;
-        for (auto state : states) { stack.push(state); closure.insert(state); }
-        while (!stack.empty()) {
-            auto current = stack.top(); stack.pop();
-            if (current->transitions.count('\0')) {
-                for (auto nextState : current->transitions['\0']) {
-                    if (!closure.count(nextState)) {
-                        closure.insert(nextState);
-                        stack.push(nextState);
+    NFAPtr createLanPieceMoveNFA() {
+        return seq(cls("[KQRBN]"), cls("[a-h]"), cls("[1-8]"), lit('-'),
+                   cls("[a-h]"), cls("[1-8]")); // Ng1-f3
+    }
+
+    NFAPtr createLanPieceCaptureNFA() {
+        return seq(cls("[KQRBN]"), cls("[a-h]"), cls("[1-8]"), lit('x'),
+                   cls("[a-h]"), cls("[1-8]")); // Ng1xf3
+    }
+
+    NFAPtr createNullMoveNFA() {
+        return alt(lit("--"), lit("Z0"));
+    }
+
+    NFAPtr createLanBaseMovesNFA() {
+        return alt(createLanPawnMoveNFA(), createLanPawnCaptureNFA(),
+                   createLanPieceMoveNFA(), createLanPieceCaptureNFA(),
+                   createCastlingNFA());
+    }
+
+    // Merged master NFA (see master_nfa.mmd): every token NFA hangs off one
+    // shared start state via epsilon, and each token keeps its own tagged
+    // accept state instead of being funneled into a common final. Priorities
+    // mirror the attempt order previously hard-coded in tryMatchLongest so
+    // same-length ties resolve identically.
+    NFAPtr createMasterNFA(GrammarProfile profile = GrammarProfile::SAN) {
+        int32_t start = createState();
+        int priority = 0;
+
+        auto addToken = [&](NFAPtr nfa, ChessTokenType type) {
+            states[start].transitions['\0'].push_back(nfa.start);
+            states[nfa.end].acceptType = type;
+            states[nfa.end].acceptPriority = priority++;
+        };
+
+        bool wantSan = profile != GrammarProfile::LAN;
+        bool wantLan = profile != GrammarProfile::SAN;
+
+        addToken(createMoveNumberNFA(), ChessTokenType::MOVE_NUMBER);
+        addToken(createResultNFA(), ChessTokenType::RESULT);
+        addToken(createCastlingNFA(), ChessTokenType::CASTLING);
+        if (wantSan) {
+            addToken(createPawnMoveNFA(), ChessTokenType::PAWN_MOVE);
+            addToken(createPieceMoveNFA(), ChessTokenType::PIECE_MOVE);
+            addToken(createPawnCaptureNFA(), ChessTokenType::PAWN_CAPTURE);
+            addToken(createPieceCaptureNFA(), ChessTokenType::PIECE_CAPTURE);
+            addToken(createPromotionNFA(), ChessTokenType::PROMOTION);
+            addToken(createTwinPieceMoveNFA(), ChessTokenType::TWIN_PIECE_MOVE);
+            addToken(createTwinPieceCaptureNFA(), ChessTokenType::TWIN_PIECE_CAPTURE);
+            addToken(createPromotionViaCaptureNFA(), ChessTokenType::PROMOTION_VIA_CAPTURE);
+            addToken(createCheckmateNFA(), ChessTokenType::CHECKMATE);
+            addToken(createCheckNFA(), ChessTokenType::CHECK);
+        }
+        if (wantLan) {
+            addToken(createLanPawnMoveNFA(), ChessTokenType::PAWN_MOVE);
+            addToken(createLanPawnCaptureNFA(), ChessTokenType::PAWN_CAPTURE);
+            addToken(createLanPieceMoveNFA(), ChessTokenType::PIECE_MOVE);
+            addToken(createLanPieceCaptureNFA(), ChessTokenType::PIECE_CAPTURE);
+            addToken(createNullMoveNFA(), ChessTokenType::NULL_MOVE);
+            addToken(seq(createLanBaseMovesNFA(), lit('#')), ChessTokenType::CHECKMATE);
+            addToken(seq(createLanBaseMovesNFA(), lit('+')), ChessTokenType::CHECK);
+        }
+        addToken(createVarBeginNFA(), ChessTokenType::VAR_BEGIN);
+        addToken(createVarEndNFA(), ChessTokenType::VAR_END);
+        addToken(createNagNFA(), ChessTokenType::NAG);
+        addToken(createAnnotationNFA(), ChessTokenType::ANNOTATION);
+
+        return {start, start};
+    }
+
+    // Per-state epsilon closures, computed once to a fixpoint; the closure
+    // of any subset is then just the word-wise OR of its members' closures.
+    vector<StateBitset> computeEpsilonClosures() {
+        size_t n = states.size();
+        vector<StateBitset> closures(n, StateBitset(n));
+        for (size_t i = 0; i < n; i++) {
+            closures[i].set((int32_t)i);
+        }
+
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (size_t i = 0; i < n; i++) {
+                auto it = states[i].transitions.find('\0');
+                if (it == states[i].transitions.end()) continue;
+                for (int32_t target : it->second) {
+                    StateBitset targetClosure = closures[target];  // copy: i may equal target
+                    if (closures[i].orWith(targetClosure)) {
+                        changed = true;
                     }
                 }
             }
         }
+        return closures;
     }
 
     set<char> getAlphabet(NFAPtr nfa) {
         set<char> alphabet;
-        set<int> visited;
+        vector<bool> visited(states.size(), false);
         collectAlphabet(nfa.start, alphabet, visited);
         return alphabet;
     }
 
     shared_ptr<DFAState> convertToDFA(NFAPtr nfa) {
-        map<set<shared_ptr<State>>, shared_ptr<DFAState>> dfaStateMap;
+        unordered_map<StateBitset, shared_ptr<DFAState>, StateBitsetHash> dfaStateMap;
         vector<shared_ptr<DFAState>> dfaStates;
         int dfaStateCounter = 0;
         set<char> alphabet = getAlphabet(nfa);
-        set<shared_ptr<State>> startSet = {nfa.start};
-        set<shared_ptr<State>> startClosure;
-        epsilonClosure(startSet, startClosure);
+        vector<StateBitset> closures = computeEpsilonClosures();
+        const StateBitset& startClosure = closures[nfa.start];
         auto startDFA = make_shared<DFAState>(dfaStateCounter++, startClosure);
         dfaStateMap[startClosure] = startDFA;
         dfaStates.push_back(startDFA);
-        for (auto state : startClosure) { if (state->isFinal) { startDFA->isFinal = true; break; } }
+        markAccepting(startDFA);
         stack<shared_ptr<DFAState>> unprocessed;
         unprocessed.push(startDFA);
         while (!unprocessed.empty()) {
             auto currentDFA = unprocessed.top(); unprocessed.pop();
             for (char c : alphabet) {
                 if (c == '\0') continue;
-                set<shared_ptr<State>> nextNFAStates;
-                for (auto nfaState : currentDFA->nfaStates) {
-                    if (nfaState->transitions.count(c)) {
-                        for (auto nextState : nfaState->transitions[c]) {
-                            nextNFAStates.insert(nextState);
+                StateBitset nextClosure(states.size());
+                currentDFA->nfaStates.forEach([&](int32_t nfaState) {
+                    auto it = states[nfaState].transitions.find(c);
+                    if (it != states[nfaState].transitions.end()) {
+                        for (int32_t nextState : it->second) {
+                            nextClosure.orWith(closures[nextState]);
                         }
                     }
-                }
-                if (!nextNFAStates.empty()) {
-                    set<shared_ptr<State>> nextClosure;
-                    epsilonClosure(nextNFAStates, nextClosure);
+                });
+                if (nextClosure.any()) {
                     if (!dfaStateMap.count(nextClosure)) {
                         auto newDFA = make_shared<DFAState>(dfaStateCounter++, nextClosure);
                         dfaStateMap[nextClosure] = newDFA;
                         dfaStates.push_back(newDFA);
-                        for (auto state : nextClosure) {
-                            if (state->isFinal) {
-                                newDFA->isFinal = true;
-                                break;
-                            }
-                        }
+                        markAccepting(newDFA);
                         unprocessed.push(newDFA);
                     }
                     currentDFA->transitions[c] = dfaStateMap[nextClosure];
                 }
             }
-        }  
+        }
         return startDFA;
     }
 
+    CompiledDFA compileDFA(shared_ptr<DFAState> start) {
+        CompiledDFA compiled;
+
+        // Breadth-first renumbering so the start state is always 0 and the
+        // table rows are laid out in discovery order.
+        map<int, int> idMap;
+        vector<shared_ptr<DFAState>> ordered;
+        idMap[start->id] = 0;
+        ordered.push_back(start);
+        for (size_t i = 0; i < ordered.size(); i++) {
+            for (const auto& transition : ordered[i]->transitions) {
+                auto target = transition.second;
+                if (!idMap.count(target->id)) {
+                    idMap[target->id] = (int)ordered.size();
+                    ordered.push_back(target);
+                }
+            }
+        }
+
+        compiled.numStates = (int)ordered.size();
+        compiled.transitions.assign((size_t)compiled.numStates * 256, -1);
+        compiled.accepting.assign(compiled.numStates, false);
+        compiled.acceptTag.assign(compiled.numStates, -1);
+
+        for (size_t i = 0; i < ordered.size(); i++) {
+            compiled.accepting[i] = ordered[i]->isFinal;
+            if (ordered[i]->isFinal && ordered[i]->acceptType != ChessTokenType::INVALID) {
+                compiled.acceptTag[i] = (int16_t)ordered[i]->acceptType;
+            }
+            for (const auto& transition : ordered[i]->transitions) {
+                unsigned char c = (unsigned char)transition.first;
+                compiled.transitions[i * 256 + c] = (int16_t)idMap[transition.second->id];
+            }
+        }
+        return compiled;
+    }
+
+    // Minimization (Moore partition refinement) over the flattened table.
+    // The initial partition separates states by accept tag so distinct token
+    // types never merge; refinement then splits groups whose members disagree
+    // on the group of any successor. The missing transition (-1) acts as an
+    // implicit dead-state group, so the table does not need completing first.
+    CompiledDFA minimizeDFA(const CompiledDFA& dfa) {
+        int n = dfa.numStates;
+        if (n == 0) return dfa;
+
+        vector<int> group(n);
+        map<int, int> tagGroup;  // accept tag (or -2 for non-accepting) -> group id
+        for (int s = 0; s < n; s++) {
+            int key = dfa.accepting[s] ? (int)dfa.acceptTag[s] : -2;
+            if (!tagGroup.count(key)) tagGroup[key] = (int)tagGroup.size();
+            group[s] = tagGroup[key];
+        }
+
+        int numGroups = (int)tagGroup.size();
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            map<vector<int>, int> signatureMap;
+            vector<int> newGroup(n);
+            for (int s = 0; s < n; s++) {
+                vector<int> signature;
+                signature.reserve(257);
+                signature.push_back(group[s]);
+                for (int c = 0; c < 256; c++) {
+                    int16_t t = dfa.transitions[(size_t)s * 256 + c];
+                    signature.push_back(t < 0 ? -1 : group[t]);
+                }
+                auto it = signatureMap.find(signature);
+                if (it == signatureMap.end()) {
+                    it = signatureMap.insert({signature, (int)signatureMap.size()}).first;
+                }
+                newGroup[s] = it->second;
+            }
+            if ((int)signatureMap.size() != numGroups) {
+                numGroups = (int)signatureMap.size();
+                changed = true;
+            }
+            group = newGroup;
+        }
+
+        // Renumber so the start state's group is 0, then emit one
+        // representative row per group.
+        vector<int> remap(numGroups, -1);
+        int nextId = 0;
+        remap[group[0]] = nextId++;
+        for (int s = 0; s < n; s++) {
+            if (remap[group[s]] == -1) remap[group[s]] = nextId++;
+        }
+
+        CompiledDFA minimized;
+        minimized.numStates = numGroups;
+        minimized.transitions.assign((size_t)numGroups * 256, -1);
+        minimized.accepting.assign(numGroups, false);
+        minimized.acceptTag.assign(numGroups, -1);
+        for (int s = 0; s < n; s++) {
+            int g = remap[group[s]];
+            minimized.accepting[g] = dfa.accepting[s];
+            minimized.acceptTag[g] = dfa.acceptTag[s];
+            for (int c = 0; c < 256; c++) {
+                int16_t t = dfa.transitions[(size_t)s * 256 + c];
+                minimized.transitions[(size_t)g * 256 + c] = t < 0 ? -1 : (int16_t)remap[group[t]];
+            }
+        }
+        return minimized;
+    }
+
+    // Alphabet equivalence-class compression over the minimized table. Two
+    // bytes are interchangeable when every state sends them to the same
+    // successor — 'b'..'h' collapse in most states, as do most digits — so
+    // the 256 columns fold into a byte->class map plus one numClasses-wide
+    // row per state. The master table shrinks roughly 8x and stays resident
+    // in L1 across a whole batch run.
+    CompiledDFA compressAlphabet(const CompiledDFA& dfa) {
+        if (dfa.numStates == 0 || dfa.numClasses != 256) return dfa;
+
+        map<vector<int16_t>, uint8_t> columnClass;  // column contents -> class id
+        CompiledDFA compressed;
+        compressed.numStates = dfa.numStates;
+        compressed.accepting = dfa.accepting;
+        compressed.acceptTag = dfa.acceptTag;
+
+        vector<vector<int16_t>> representatives;
+        for (int c = 0; c < 256; c++) {
+            vector<int16_t> column(dfa.numStates);
+            for (int s = 0; s < dfa.numStates; s++) {
+                column[s] = dfa.transitions[(size_t)s * 256 + c];
+            }
+            auto it = columnClass.find(column);
+            if (it == columnClass.end()) {
+                it = columnClass.insert({column, (uint8_t)representatives.size()}).first;
+                representatives.push_back(move(column));
+            }
+            compressed.byteClass[c] = it->second;
+        }
+
+        compressed.numClasses = (int)representatives.size();
+        compressed.transitions.assign((size_t)compressed.numStates * compressed.numClasses, -1);
+        for (int k = 0; k < compressed.numClasses; k++) {
+            for (int s = 0; s < compressed.numStates; s++) {
+                compressed.transitions[(size_t)s * compressed.numClasses + k] = representatives[k][s];
+            }
+        }
+        return compressed;
+    }
+
+    CompiledDFA compileMinimized(NFAPtr nfa) {
+        return compressAlphabet(minimizeDFA(compileDFA(convertToDFA(nfa))));
+    }
+
 private:
+    // A DFA state accepts if any NFA state in its subset accepts; when
+    // several tagged accepts land in the same subset the lowest priority
+    // (earliest attempt order) wins.
+    void markAccepting(shared_ptr<DFAState> dfaState) {
+        dfaState->nfaStates.forEach([&](int32_t s) {
+            const State& state = states[s];
+            if (!state.isFinal) return;
+            dfaState->isFinal = true;
+            if (state.acceptPriority < dfaState->acceptPriority) {
+                dfaState->acceptPriority = state.acceptPriority;
+                dfaState->acceptType = state.acceptType;
+            }
+        });
+    }
+
     void parseCharacterClass(const string& charClass, set<char>& validChars) {
         if (charClass.empty() || charClass[0] != '[' || charClass.back() != ']') {
             cerr << "[ERROR] Invalid character class format.\n";
@@ -399,24 +949,24 @@ private:
     }
 
     NFAPtr kleeneStar(NFAPtr a) {
-        auto start = createState();
-        auto end = createState();
-        start->transitions['\0'].push_back(a.start);
-        start->transitions['\0'].push_back(end);
-        a.end->transitions['\0'].push_back(a.start);
-        a.end->transitions['\0'].push_back(end);
-        a.end->isFinal = false;
-        end->isFinal = true;
+        int32_t start = createState();
+        int32_t end = createState();
+        states[start].transitions['\0'].push_back(a.start);
+        states[start].transitions['\0'].push_back(end);
+        states[a.end].transitions['\0'].push_back(a.start);
+        states[a.end].transitions['\0'].push_back(end);
+        states[a.end].isFinal = false;
+        states[end].isFinal = true;
         return {start, end};
     }
 
-    void collectAlphabet(shared_ptr<State> state, set<char>& alphabet, set<int>& visited) {
-        if (visited.count(state->id)) return;
-        visited.insert(state->id);
-        for (const auto& transition : state->transitions) {
+    void collectAlphabet(int32_t state, set<char>& alphabet, vector<bool>& visited) {
+        if (visited[state]) return;
+        visited[state] = true;
+        for (const auto& transition : states[state].transitions) {
             char symbol = transition.first;
             if (symbol != '\0') { alphabet.insert(symbol); }
-            for (const auto& nextState : transition.second) {
+            for (int32_t nextState : transition.second) {
                 collectAlphabet(nextState, alphabet, visited);
             }
         }
@@ -426,153 +976,435 @@ private:
 // ========== CHESS LEXICAL ANALYZER ==========
 class ChessLexer {
 private:
-    shared_ptr<DFAState> moveNumberDFA;
-    shared_ptr<DFAState> pawnMoveDFA;
-    shared_ptr<DFAState> pieceMoveDFA;
-    shared_ptr<DFAState> twinPieceMoveDFA;
-    shared_ptr<DFAState> pawnCaptureDFA;
-    shared_ptr<DFAState> pieceCaptureDFA;
-    shared_ptr<DFAState> twinPieceCaptureDFA;
-    shared_ptr<DFAState> castlingDFA;
-    shared_ptr<DFAState> promotionDFA;
-    shared_ptr<DFAState> promotionViaCaptureDFA;
-    shared_ptr<DFAState> checkDFA;
-    shared_ptr<DFAState> checkmateDFA;
-    shared_ptr<DFAState> resultDFA;
-    shared_ptr<DFAState> VarBeginDFA;
-    shared_ptr<DFAState> VarEndDFA;
+    CompiledDFA moveNumberDFA;
+    CompiledDFA pawnMoveDFA;
+    CompiledDFA pieceMoveDFA;
+    CompiledDFA twinPieceMoveDFA;
+    CompiledDFA pawnCaptureDFA;
+    CompiledDFA pieceCaptureDFA;
+    CompiledDFA twinPieceCaptureDFA;
+    CompiledDFA castlingDFA;
+    CompiledDFA promotionDFA;
+    CompiledDFA promotionViaCaptureDFA;
+    CompiledDFA checkDFA;
+    CompiledDFA checkmateDFA;
+    CompiledDFA resultDFA;
+    CompiledDFA VarBeginDFA;
+    CompiledDFA VarEndDFA;
+    CompiledDFA nagDFA;
+    CompiledDFA annotationDFA;
+
+    // Merged automaton covering every token type; accepting states carry the
+    // winning ChessTokenType so one pass resolves the longest match. The
+    // per-token DFAs above are kept as a debug/cross-check path.
+    CompiledDFA masterDFA;
+    bool useMasterDFA;
+    GrammarProfile profile;
+    bool verbose;
+
+    // Recovery mode: coalesce runs of unmatchable bytes into one INVALID
+    // span token and cap recorded errors, instead of one printed diagnostic
+    // per bad byte.
+    bool recover;
+
+    // Mainline-only mode: a '(' triggers a raw bracket-depth scan to the
+    // matching ')' — no DFA work, no tokens for the whole subtree.
+    bool skipVariations;
+
+    // Reusable token buffer ("arena"): grows to the largest game seen and is
+    // recycled across tokenize calls.
+    vector<ChessToken> tokenArena;
+
+    // Separate-DFA path: the candidate automata in longest-match attempt
+    // order, plus a 256-entry first-byte dispatch table. Bit i of
+    // firstByteDispatch[b] is set when candidateDFAs[i] has a start-state
+    // transition on byte b, so most positions try ~2 automata instead of
+    // all of them.
+    struct TokenPattern {
+        const CompiledDFA* dfa;
+        ChessTokenType type;
+    };
+    vector<TokenPattern> candidateDFAs;
+    uint32_t firstByteDispatch[256];
+
+    // Fixed-capacity candidate scratch: there can never be more candidates
+    // than automata, so a plain inline array of (type, length) pairs removes
+    // the per-token vector allocation the old path paid. string_views are
+    // rebuilt from the lengths at the end, so nothing is copied either.
+    struct Candidate {
+        ChessTokenType type;
+        int length;
+    };
+    Candidate candidateScratch[32];
+    int candidateCount;
 
 public:
-    ChessLexer() {
+    ChessLexer() : useMasterDFA(true), profile(GrammarProfile::SAN),
+                   verbose(true), recover(false), skipVariations(false),
+                   candidateCount(0) {
         initializeTokenDFAs();
     }
 
+    void setUseMasterDFA(bool enabled) {
+        useMasterDFA = enabled;
+    }
+
+    void setVerbose(bool enabled) {
+        verbose = enabled;
+    }
+
+    void setRecover(bool enabled) {
+        recover = enabled;
+    }
+
+    void setSkipVariations(bool enabled) {
+        skipVariations = enabled;
+    }
+
+    // Swapping the profile swaps the master automaton; the separate-DFA
+    // debug path is unaffected (it stays SAN).
+    void setProfile(GrammarProfile newProfile) {
+        if (profile == newProfile) return;
+        profile = newProfile;
+#ifdef CHESSNOT_PRECOMPILED_TABLES
+        masterDFA = loadPrecompiled(masterTableFor(profile));
+#else
+        ChessNFA nfaBuilder;
+        masterDFA = nfaBuilder.compileMinimized(nfaBuilder.createMasterNFA(profile));
+#endif
+    }
+
     void initializeTokenDFAs() {
+#ifdef CHESSNOT_PRECOMPILED_TABLES
+        moveNumberDFA = loadPrecompiled(chessNotTables::moveNumber);
+        pawnMoveDFA = loadPrecompiled(chessNotTables::pawnMove);
+        pieceMoveDFA = loadPrecompiled(chessNotTables::pieceMove);
+        twinPieceMoveDFA = loadPrecompiled(chessNotTables::twinPieceMove);
+        pawnCaptureDFA = loadPrecompiled(chessNotTables::pawnCapture);
+        pieceCaptureDFA = loadPrecompiled(chessNotTables::pieceCapture);
+        twinPieceCaptureDFA = loadPrecompiled(chessNotTables::twinPieceCapture);
+        castlingDFA = loadPrecompiled(chessNotTables::castling);
+        promotionDFA = loadPrecompiled(chessNotTables::promotion);
+        promotionViaCaptureDFA = loadPrecompiled(chessNotTables::promotionViaCapture);
+        checkDFA = loadPrecompiled(chessNotTables::check);
+        checkmateDFA = loadPrecompiled(chessNotTables::checkmate);
+        resultDFA = loadPrecompiled(chessNotTables::result);
+        VarBeginDFA = loadPrecompiled(chessNotTables::varBegin);
+        VarEndDFA = loadPrecompiled(chessNotTables::varEnd);
+        nagDFA = loadPrecompiled(chessNotTables::nag);
+        annotationDFA = loadPrecompiled(chessNotTables::annotation);
+        masterDFA = loadPrecompiled(masterTableFor(profile));
+#else
+        buildTokenDFAs();
+#endif
+        buildDispatchTable();
+    }
+
+    void buildDispatchTable() {
+        candidateDFAs = {
+            {&moveNumberDFA, ChessTokenType::MOVE_NUMBER},
+            {&resultDFA, ChessTokenType::RESULT},
+            {&castlingDFA, ChessTokenType::CASTLING},
+            {&pawnMoveDFA, ChessTokenType::PAWN_MOVE},
+            {&pieceMoveDFA, ChessTokenType::PIECE_MOVE},
+            {&pawnCaptureDFA, ChessTokenType::PAWN_CAPTURE},
+            {&pieceCaptureDFA, ChessTokenType::PIECE_CAPTURE},
+            {&promotionDFA, ChessTokenType::PROMOTION},
+            {&twinPieceMoveDFA, ChessTokenType::TWIN_PIECE_MOVE},
+            {&twinPieceCaptureDFA, ChessTokenType::TWIN_PIECE_CAPTURE},
+            {&promotionViaCaptureDFA, ChessTokenType::PROMOTION_VIA_CAPTURE},
+            {&checkmateDFA, ChessTokenType::CHECKMATE},
+            {&checkDFA, ChessTokenType::CHECK},
+            {&VarBeginDFA, ChessTokenType::VAR_BEGIN},
+            {&VarEndDFA, ChessTokenType::VAR_END},
+            {&nagDFA, ChessTokenType::NAG},
+            {&annotationDFA, ChessTokenType::ANNOTATION},
+        };
+        for (int byte = 0; byte < 256; byte++) {
+            uint32_t mask = 0;
+            for (size_t i = 0; i < candidateDFAs.size(); i++) {
+                if (candidateDFAs[i].dfa->next(0, (unsigned char)byte) >= 0) {
+                    mask |= 1u << i;
+                }
+            }
+            firstByteDispatch[byte] = mask;
+        }
+    }
+
+    void buildTokenDFAs() {
         ChessNFA nfaBuilder;
-        moveNumberDFA = nfaBuilder.convertToDFA(nfaBuilder.createMoveNumberNFA());
-        pawnMoveDFA = nfaBuilder.convertToDFA(nfaBuilder.createPawnMoveNFA());
-        pieceMoveDFA = nfaBuilder.convertToDFA(nfaBuilder.createPieceMoveNFA());
-        twinPieceMoveDFA = nfaBuilder.convertToDFA(nfaBuilder.createTwinPieceMoveNFA());
-        pawnCaptureDFA = nfaBuilder.convertToDFA(nfaBuilder.createPawnCaptureNFA());
-        pieceCaptureDFA = nfaBuilder.convertToDFA(nfaBuilder.createPieceCaptureNFA());
-        twinPieceCaptureDFA = nfaBuilder.convertToDFA(nfaBuilder.createTwinPieceCaptureNFA());
-        castlingDFA = nfaBuilder.convertToDFA(nfaBuilder.createCastlingNFA()); 
-        promotionDFA = nfaBuilder.convertToDFA(nfaBuilder.createPromotionNFA());
-        promotionViaCaptureDFA = nfaBuilder.convertToDFA(nfaBuilder.createPromotionViaCaptureNFA());
-        checkDFA = nfaBuilder.convertToDFA(nfaBuilder.createCheckNFA());
-        checkmateDFA = nfaBuilder.convertToDFA(nfaBuilder.createCheckmateNFA());
-        resultDFA = nfaBuilder.convertToDFA(nfaBuilder.createResultNFA());
-        VarBeginDFA = nfaBuilder.convertToDFA(nfaBuilder.createVarBeginNFA());
-        VarEndDFA = nfaBuilder.convertToDFA(nfaBuilder.createVarEndNFA());
-    }
-
-    pair<vector<ChessToken>, bool> tokenize(const string& input) {
-        vector<ChessToken> tokens;
+        moveNumberDFA = nfaBuilder.compileMinimized(nfaBuilder.createMoveNumberNFA());
+        pawnMoveDFA = nfaBuilder.compileMinimized(nfaBuilder.createPawnMoveNFA());
+        pieceMoveDFA = nfaBuilder.compileMinimized(nfaBuilder.createPieceMoveNFA());
+        twinPieceMoveDFA = nfaBuilder.compileMinimized(nfaBuilder.createTwinPieceMoveNFA());
+        pawnCaptureDFA = nfaBuilder.compileMinimized(nfaBuilder.createPawnCaptureNFA());
+        pieceCaptureDFA = nfaBuilder.compileMinimized(nfaBuilder.createPieceCaptureNFA());
+        twinPieceCaptureDFA = nfaBuilder.compileMinimized(nfaBuilder.createTwinPieceCaptureNFA());
+        castlingDFA = nfaBuilder.compileMinimized(nfaBuilder.createCastlingNFA());
+        promotionDFA = nfaBuilder.compileMinimized(nfaBuilder.createPromotionNFA());
+        promotionViaCaptureDFA = nfaBuilder.compileMinimized(nfaBuilder.createPromotionViaCaptureNFA());
+        checkDFA = nfaBuilder.compileMinimized(nfaBuilder.createCheckNFA());
+        checkmateDFA = nfaBuilder.compileMinimized(nfaBuilder.createCheckmateNFA());
+        resultDFA = nfaBuilder.compileMinimized(nfaBuilder.createResultNFA());
+        VarBeginDFA = nfaBuilder.compileMinimized(nfaBuilder.createVarBeginNFA());
+        VarEndDFA = nfaBuilder.compileMinimized(nfaBuilder.createVarEndNFA());
+        nagDFA = nfaBuilder.compileMinimized(nfaBuilder.createNagNFA());
+        annotationDFA = nfaBuilder.compileMinimized(nfaBuilder.createAnnotationNFA());
+        masterDFA = nfaBuilder.compileMinimized(nfaBuilder.createMasterNFA(profile));
+    }
+
+    // Tokenizes into a reusable member buffer: clear() keeps the capacity
+    // from previous games, so steady-state tokenization performs no
+    // token-related allocations. The returned reference stays valid until
+    // the next tokenize call on this lexer.
+    const vector<ChessToken>& tokenize(string_view input, bool& hadLexicalError,
+                                       ValidationReport* report = nullptr) {
+        tokenizeInto(input, tokenArena, hadLexicalError, report);
+        return tokenArena;
+    }
+
+    // Same scan, but into a caller-owned buffer — the pipeline engine hands
+    // recycled batch buffers here so token batches can cross threads by
+    // pointer while this lexer moves on to the next game.
+    void tokenizeInto(string_view input, vector<ChessToken>& tokens,
+                      bool& hadLexicalError, ValidationReport* report = nullptr) {
+        tokens.clear();
+        tokenizeToSink(input, hadLexicalError, report,
+                       [&](const ChessToken& token) { tokens.push_back(token); });
+    }
+
+    // SoA variant of tokenizeInto: fills parallel type/offset/length arrays
+    // (see TokenStream) instead of a ChessToken vector.
+    void tokenizeStream(string_view input, TokenStream& out, bool& hadLexicalError,
+                        ValidationReport* report = nullptr) {
+        out.clear();
+        tokenizeToSink(input, hadLexicalError, report, [&](const ChessToken& token) {
+            out.push(token.type, (uint32_t)token.position, token.value.length());
+        });
+    }
+
+    // Fused single-pass core: every token (END_OF_INPUT included) goes
+    // straight to the sink the moment it is matched, so a caller that feeds
+    // the validator from here never materializes a token vector at all —
+    // one pass over the game, O(1) token memory.
+    template <typename Sink>
+    void tokenizeToSink(string_view input, bool& hadLexicalError,
+                        ValidationReport* report, Sink&& sink) {
         int pos = 0;
-        int length = input.length();
-        bool hadLexicalError = false;
+        int length = (int)input.length();
+        hadLexicalError = false;
 
         while (pos < length) {
-            if (isspace(input[pos])) {
-                pos++;
+            pos = skipWhitespace(input, pos);
+            if (pos >= length) {
+                break;
+            }
+
+            if (skipVariations && input[pos] == '(') {
+                // Hop over the whole variation subtree at memchr speed: track
+                // bracket depth between the next '(' and ')' hits and resume
+                // after the matching close. The interior is never tokenized;
+                // only a synthetic VAR_BEGIN/VAR_END pair reaches the sink,
+                // because a variation's sole effect on the mainline PDA is
+                // the push/pop itself (move numbers may legally repeat right
+                // after a ')').
+                int depth = 1;
+                size_t scan = (size_t)pos + 1;
+                while (scan < (size_t)length && depth > 0) {
+                    const char* open = (const char*)memchr(input.data() + scan, '(', length - scan);
+                    const char* close = (const char*)memchr(input.data() + scan, ')', length - scan);
+                    if (close == nullptr) {
+                        scan = (size_t)length;
+                        break;
+                    }
+                    if (open != nullptr && open < close) {
+                        depth++;
+                        scan = (size_t)(open - input.data()) + 1;
+                    } else {
+                        depth--;
+                        scan = (size_t)(close - input.data()) + 1;
+                    }
+                }
+                if (depth > 0) {
+                    // Ran off the end before the subtree closed: hand the
+                    // bare VAR_BEGIN through so the PDA reports the unclosed
+                    // variation exactly as it would without skipping.
+                    sink(ChessToken(ChessTokenType::VAR_BEGIN, input.substr(pos, 1), pos));
+                } else {
+                    sink(ChessToken(ChessTokenType::VAR_BEGIN, input.substr(pos, 1), pos));
+                    sink(ChessToken(ChessTokenType::VAR_END,
+                                    input.substr(scan - 1, 1), (int)(scan - 1)));
+                }
+                pos = (int)scan;
                 continue;
             }
 
             ChessToken token = getNextToken(input, pos);
             if (token.type == ChessTokenType::INVALID) {
-                cout << "[LEXER ERROR] Invalid token at position " << pos 
+                if (recover) {
+                    // Swallow the whole garbage run in one step: extend the
+                    // span until whitespace or a byte that could start a
+                    // token, emit a single INVALID span token, and record at
+                    // most one capped error for the run.
+                    int spanEnd = pos + 1;
+                    while (spanEnd < length && !isPgnWhitespace(input[spanEnd]) &&
+                           masterDFA.next(0, (unsigned char)input[spanEnd]) < 0) {
+                        spanEnd++;
+                    }
+                    if (report) {
+                        if (report->errors.size() < ValidationReport::RECOVERY_ERROR_CAP) {
+                            report->errors.push_back({ValidationErrorCode::INVALID_TOKEN, pos});
+                        } else {
+                            report->errorsTruncated = true;
+                        }
+                        report->lexicalValid = false;
+                    }
+                    hadLexicalError = true;
+                    sink(ChessToken(ChessTokenType::INVALID,
+                                    input.substr(pos, spanEnd - pos), pos));
+                    pos = spanEnd;
+                    continue;
+                }
+
+                if (verbose) cout << "[LEXER ERROR] Invalid token at position " << pos
                      << ": '" << input.substr(pos, 1) << "' in context: '"
                      << input.substr(max(0, pos-3), min(7, (int)input.length()-max(0,pos-3))) << "'" << endl;
-                
+
+                if (report) {
+                    report->errors.push_back({ValidationErrorCode::INVALID_TOKEN, pos});
+                    report->lexicalValid = false;
+                }
                 hadLexicalError = true;
                 pos++;
             } else {
-                tokens.push_back(token);
+                CHESSNOT_STAT(tlsStats.tokensPerType[(int)token.type]++);
+                sink(token);
                 pos += token.value.length();
             }
         }
 
-        tokens.push_back(ChessToken(ChessTokenType::END_OF_INPUT, "", pos));
-        return {tokens, hadLexicalError};
+        sink(ChessToken(ChessTokenType::END_OF_INPUT, string_view(), pos));
     }
 
-    ChessToken getNextToken(const string& input, int startPos) {
+    ChessToken getNextToken(string_view input, int startPos) {
         ChessToken token = tryMatchLongest(input, startPos);
         if (token.type != ChessTokenType::INVALID) {
             return token;
         }
-        return ChessToken(ChessTokenType::INVALID, string(1, input[startPos]), startPos);
+        return ChessToken(ChessTokenType::INVALID, input.substr(startPos, 1), startPos);
     }
 
-    ChessToken tryMatchLongest(const string& input, int startPos) {
+    ChessToken tryMatchLongest(string_view input, int startPos) {
         if (startPos < (int)input.length()) {
             char ch = input[startPos];
             if (ch == '(') {
-                return ChessToken(ChessTokenType::VAR_BEGIN, string(1, '('), startPos);
+                return ChessToken(ChessTokenType::VAR_BEGIN, input.substr(startPos, 1), startPos);
             } else if (ch == ')') {
-                return ChessToken(ChessTokenType::VAR_END, string(1, ')'), startPos);
-            }
-        }
-
-        vector<pair<ChessTokenType, string>> candidates;
-        testDFAPattern(moveNumberDFA, input, startPos, ChessTokenType::MOVE_NUMBER, candidates);
-        testDFAPattern(resultDFA, input, startPos, ChessTokenType::RESULT, candidates);
-        testDFAPattern(castlingDFA, input, startPos, ChessTokenType::CASTLING, candidates);
-        testDFAPattern(pawnMoveDFA, input, startPos, ChessTokenType::PAWN_MOVE, candidates);
-        testDFAPattern(pieceMoveDFA, input, startPos, ChessTokenType::PIECE_MOVE, candidates);
-        testDFAPattern(pawnCaptureDFA, input, startPos, ChessTokenType::PAWN_CAPTURE, candidates);
-        testDFAPattern(pieceCaptureDFA, input, startPos, ChessTokenType::PIECE_CAPTURE, candidates);   
-        testDFAPattern(promotionDFA, input, startPos, ChessTokenType::PROMOTION, candidates);
-        testDFAPattern(twinPieceMoveDFA, input, startPos, ChessTokenType::TWIN_PIECE_MOVE, candidates);
-        testDFAPattern(twinPieceCaptureDFA, input, startPos, ChessTokenType::TWIN_PIECE_CAPTURE, candidates);
-        testDFAPattern(promotionViaCaptureDFA, input, startPos, ChessTokenType::PROMOTION_VIA_CAPTURE, candidates);
-        testDFAPattern(checkmateDFA, input, startPos, ChessTokenType::CHECKMATE, candidates);
-        testDFAPattern(checkDFA, input, startPos, ChessTokenType::CHECK, candidates);
-        testDFAPattern(VarBeginDFA, input, startPos, ChessTokenType::VAR_BEGIN, candidates);
-        testDFAPattern(VarEndDFA, input, startPos, ChessTokenType::VAR_END, candidates);
-
-        if (!candidates.empty()) {
-            auto longest = candidates[0];
-            for (const auto& candidate : candidates) {
-                if (candidate.second.length() > longest.second.length()) {
-                    longest = candidate;
+                return ChessToken(ChessTokenType::VAR_END, input.substr(startPos, 1), startPos);
+            } else if (ch == '{') {
+                // Comments are free text with no internal structure, so a
+                // plain skip-scan to the closing brace beats running a DFA
+                // over every byte. An unterminated comment swallows the rest
+                // of the input, matching how most PGN readers treat it.
+                size_t close = input.find('}', startPos + 1);
+                size_t commentEnd = (close == string_view::npos) ? input.length() : close + 1;
+                return ChessToken(ChessTokenType::COMMENT,
+                                  input.substr(startPos, commentEnd - startPos), startPos);
+            }
+        }
+
+        if (useMasterDFA) {
+            return tryMatchMaster(input, startPos);
+        }
+
+        candidateCount = 0;
+        uint32_t viable = firstByteDispatch[(unsigned char)input[startPos]];
+        while (viable) {
+            int i = __builtin_ctz(viable);
+            viable &= viable - 1;
+            testDFAPattern(*candidateDFAs[i].dfa, input, startPos, candidateDFAs[i].type);
+        }
+
+        if (candidateCount > 0) {
+            Candidate longest = candidateScratch[0];
+            for (int i = 1; i < candidateCount; i++) {
+                if (candidateScratch[i].length > longest.length) {
+                    longest = candidateScratch[i];
                 }
             }
-            return ChessToken(longest.first, longest.second, startPos);
+            return ChessToken(longest.type, input.substr(startPos, longest.length), startPos);
         }
         return ChessToken(ChessTokenType::INVALID, "", startPos);
     }
 
-    void testDFAPattern(shared_ptr<DFAState> dfa, const string& input, int startPos, 
-                         ChessTokenType type, vector<pair<ChessTokenType, string>>& candidates) {
-        string matchedValue;
+    // One pass over the input with the merged automaton: track the last
+    // accepting position and its tag, so the longest match (ties already
+    // resolved inside the DFA by priority) falls out of a single scan.
+    ChessToken tryMatchMaster(string_view input, int startPos) {
+        int currentState = 0;
+        int pos = startPos;
+        int lastAcceptPos = -1;
+        int16_t lastAcceptTag = -1;
+
+        while (pos < (int)input.length()) {
+            int16_t nextState = masterDFA.next(currentState, (unsigned char)input[pos]);
+            if (nextState < 0) {
+                break;
+            }
+
+            currentState = nextState;
+            pos++;
+            CHESSNOT_STAT(tlsStats.dfaSteps++);
+
+            int16_t tag = masterDFA.tagOf(currentState);
+            if (tag >= 0) {
+                lastAcceptPos = pos;
+                lastAcceptTag = tag;
+            }
+        }
+
+        if (lastAcceptPos == -1) {
+            return ChessToken(ChessTokenType::INVALID, string_view(), startPos);
+        }
+        CHESSNOT_STAT(tlsStats.backtrackBytes += pos - lastAcceptPos);
+        return ChessToken((ChessTokenType)lastAcceptTag,
+                          input.substr(startPos, lastAcceptPos - startPos), startPos);
+    }
+
+    void testDFAPattern(const CompiledDFA& dfa, string_view input, int startPos,
+                         ChessTokenType type) {
+        string_view matchedValue;
         if (tryMatchDFA(dfa, input, startPos, matchedValue)) {
-            candidates.push_back({type, matchedValue});
+            candidateScratch[candidateCount++] = {type, (int)matchedValue.length()};
         }
     }
 
-    bool tryMatchDFA(shared_ptr<DFAState> dfa, const string& input, int startPos, string& matchedValue) {
-        auto currentState = dfa;
+    bool tryMatchDFA(const CompiledDFA& dfa, string_view input, int startPos, string_view& matchedValue) {
+        int currentState = 0;
         int pos = startPos;
         int lastAcceptPos = -1;
-        string currentMatch;
 
-        while (pos < input.length()) {
-            char c = input[pos];
-            if (!currentState->transitions.count(c)) {
+        while (pos < (int)input.length()) {
+            int16_t nextState = dfa.next(currentState, (unsigned char)input[pos]);
+            if (nextState < 0) {
                 break;
             }
 
-            currentState = currentState->transitions[input[pos]];
+            currentState = nextState;
             pos++;
-            currentMatch = input.substr(startPos, pos - startPos);
+            CHESSNOT_STAT(tlsStats.dfaSteps++);
 
-            if (currentState->isFinal) {
+            if (dfa.isAccepting(currentState)) {
                 lastAcceptPos = pos;
-                matchedValue = currentMatch;
             }
         }
-        return lastAcceptPos != -1;
+
+        if (lastAcceptPos == -1) {
+            return false;
+        }
+        CHESSNOT_STAT(tlsStats.backtrackBytes += pos - lastAcceptPos);
+        matchedValue = input.substr(startPos, lastAcceptPos - startPos);
+        return true;
     }
 
     void displayTokens(const vector<ChessToken>& tokens) {
@@ -603,12 +1435,137 @@ public:
                 case ChessTokenType::RESULT:      typeStr = "RESULT     "; break;
                 case ChessTokenType::VAR_BEGIN: typeStr = "VAR_BEGIN  "; break;
                 case ChessTokenType::VAR_END:   typeStr = "VAR_END    "; break;
+                case ChessTokenType::COMMENT:     typeStr = "COMMENT    "; break;
+                case ChessTokenType::NAG:         typeStr = "NAG        "; break;
+                case ChessTokenType::ANNOTATION:  typeStr = "ANNOTATION "; break;
+                case ChessTokenType::NULL_MOVE:   typeStr = "NULL_MOVE  "; break;
                 case ChessTokenType::END_OF_INPUT:typeStr = "END_OF_INPUT"; break;
                 case ChessTokenType::INVALID:     typeStr = "INVALID    "; break;
             }
             cout << " " << token.position << "     | " << typeStr << " | " << token.value << "\n";
         }
     }
+
+#ifdef CHESSNOT_PRECOMPILED_TABLES
+    static const chessNotTables::PrecompiledDFATable& masterTableFor(GrammarProfile profile) {
+        switch (profile) {
+            case GrammarProfile::LAN:      return chessNotTables::masterLan;
+            case GrammarProfile::COMBINED: return chessNotTables::masterCombined;
+            default:                       return chessNotTables::master;
+        }
+    }
+
+    static CompiledDFA loadPrecompiled(const chessNotTables::PrecompiledDFATable& table) {
+        CompiledDFA dfa;
+        dfa.numStates = table.numStates;
+        dfa.numClasses = table.numClasses;
+        dfa.byteClass.assign(table.byteClass, table.byteClass + 256);
+        dfa.transitions.assign(table.transitions,
+                               table.transitions + (size_t)table.numStates * table.numClasses);
+        dfa.accepting.assign(table.accepting, table.accepting + table.numStates);
+        dfa.acceptTag.assign(table.acceptTag, table.acceptTag + table.numStates);
+        return dfa;
+    }
+#endif
+
+    // Offline "compile" mode: dump every automaton as constexpr arrays into a
+    // header the next build can link against (see the note at the top of the
+    // file). Always regenerates from the NFA builders so the emitted tables
+    // reflect the current grammar even in an already-precompiled binary.
+    bool emitPrecompiledTables(const string& path) {
+        buildTokenDFAs();
+
+        ChessNFA lanBuilder;
+        CompiledDFA masterLanDFA =
+            lanBuilder.compileMinimized(lanBuilder.createMasterNFA(GrammarProfile::LAN));
+        ChessNFA combinedBuilder;
+        CompiledDFA masterCombinedDFA =
+            combinedBuilder.compileMinimized(combinedBuilder.createMasterNFA(GrammarProfile::COMBINED));
+
+        ofstream out(path);
+        if (!out.is_open()) {
+            cerr << "[ERROR] Could not open " << path << " for writing.\n";
+            return false;
+        }
+
+        out << "// Generated by chessNot --emit-tables. Do not edit by hand;\n";
+        out << "// regenerate after any change to the token grammar.\n";
+        out << "#pragma once\n";
+        out << "#include <cstdint>\n\n";
+        out << "namespace chessNotTables {\n\n";
+        out << "struct PrecompiledDFATable {\n";
+        out << "    int numStates;\n";
+        out << "    int numClasses;\n";
+        out << "    const uint8_t* byteClass;\n";
+        out << "    const int16_t* transitions;\n";
+        out << "    const uint8_t* accepting;\n";
+        out << "    const int16_t* acceptTag;\n";
+        out << "};\n";
+
+        pair<const char*, const CompiledDFA*> tables[] = {
+            {"moveNumber", &moveNumberDFA},
+            {"pawnMove", &pawnMoveDFA},
+            {"pieceMove", &pieceMoveDFA},
+            {"twinPieceMove", &twinPieceMoveDFA},
+            {"pawnCapture", &pawnCaptureDFA},
+            {"pieceCapture", &pieceCaptureDFA},
+            {"twinPieceCapture", &twinPieceCaptureDFA},
+            {"castling", &castlingDFA},
+            {"promotion", &promotionDFA},
+            {"promotionViaCapture", &promotionViaCaptureDFA},
+            {"check", &checkDFA},
+            {"checkmate", &checkmateDFA},
+            {"result", &resultDFA},
+            {"varBegin", &VarBeginDFA},
+            {"varEnd", &VarEndDFA},
+            {"nag", &nagDFA},
+            {"annotation", &annotationDFA},
+            {"master", &masterDFA},
+            {"masterLan", &masterLanDFA},
+            {"masterCombined", &masterCombinedDFA},
+        };
+
+        for (const auto& entry : tables) {
+            const char* name = entry.first;
+            const CompiledDFA& dfa = *entry.second;
+
+            out << "\ninline constexpr uint8_t " << name << "_byteClass[] = {";
+            for (size_t i = 0; i < dfa.byteClass.size(); i++) {
+                if (i % 16 == 0) out << "\n    ";
+                out << (int)dfa.byteClass[i] << ",";
+            }
+            out << "\n};\n";
+
+            out << "inline constexpr int16_t " << name << "_transitions[] = {";
+            for (size_t i = 0; i < dfa.transitions.size(); i++) {
+                if (i % 16 == 0) out << "\n    ";
+                out << dfa.transitions[i] << ",";
+            }
+            out << "\n};\n";
+
+            out << "inline constexpr uint8_t " << name << "_accepting[] = {";
+            for (size_t i = 0; i < dfa.accepting.size(); i++) {
+                if (i % 16 == 0) out << "\n    ";
+                out << (dfa.accepting[i] ? 1 : 0) << ",";
+            }
+            out << "\n};\n";
+
+            out << "inline constexpr int16_t " << name << "_acceptTag[] = {";
+            for (size_t i = 0; i < dfa.acceptTag.size(); i++) {
+                if (i % 16 == 0) out << "\n    ";
+                out << dfa.acceptTag[i] << ",";
+            }
+            out << "\n};\n";
+
+            out << "inline constexpr PrecompiledDFATable " << name << " = {"
+                << dfa.numStates << ", " << dfa.numClasses << ", "
+                << name << "_byteClass, " << name << "_transitions, "
+                << name << "_accepting, " << name << "_acceptTag};\n";
+        }
+
+        out << "\n} // namespace chessNotTables\n";
+        return true;
+    }
 };
 
 // ========== CHESS SYNTACTIC VALIDATOR ==========
@@ -624,6 +1581,29 @@ private:
 
     vector<PDAContext> pdaStack;
 
+    // When false every diagnostic print is suppressed, so the validator can
+    // run on worker threads without interleaving output.
+    bool verbose;
+
+    // Streaming state carried between feedToken calls.
+    size_t fedCount;
+    ChessTokenType prev1Type;
+    ChessTokenType prev2Type;
+    int prev1Position;
+    size_t prev1Length;
+    string_view prev1Value;
+    bool touchingErrorFound;
+    bool pendingCheckmate;
+    int pendingCheckmatePos;
+    string_view pendingCheckmateValue;
+    bool failed;
+
+    // Recovery mode: instead of abandoning the game at the first sequence
+    // error, hunt for the next MOVE_NUMBER and resynchronize the PDA there.
+    bool recover;
+    bool resyncing;
+    bool errorFound;
+
     bool isLegalMoveSymbol(ChessTokenType type) const {
         return type == ChessTokenType::PAWN_MOVE ||
                type == ChessTokenType::PIECE_MOVE ||
@@ -635,181 +1615,1460 @@ private:
                type == ChessTokenType::PROMOTION ||
                type == ChessTokenType::PROMOTION_VIA_CAPTURE ||
                type == ChessTokenType::CHECK ||
-               type == ChessTokenType::CHECKMATE;
+               type == ChessTokenType::CHECKMATE ||
+               type == ChessTokenType::NULL_MOVE;
     }
 
 public:
-    ChessSyntacticValidator() {
-        resetPDA();
+    ChessSyntacticValidator() : verbose(true), recover(false) {
+        beginGame();
     }
 
-    bool validateSyntax(const vector<ChessToken>& tokens) {
-        cout << "\n=== SYNTACTIC VALIDATION ===\n";
-
-        bool hasErrors = false;
-        for (size_t i = 0; i < tokens.size() - 1; ++i) {
-            const auto& current = tokens[i];
-            const auto& next = tokens[i+1];
-            if (isPrimaryMove(current) && isPrimaryMove(next)) {
-                if (current.position + current.value.length() == next.position) {
-                    cout << "SYNTAX ERROR: Primary move tokens found **physically touching** in input: '" 
-                         << current.value << "' at pos " << current.position << " followed by '" 
-                         << next.value << "' at pos " << next.position << ". Tokens must be separated by space/number.\n";
-                    hasErrors = true;
-                    break;
-                }
-            }
-        }
+    void setVerbose(bool enabled) {
+        verbose = enabled;
+    }
 
-        resetPDA();
-        for (size_t i = 0; i < tokens.size(); ++i) {
-            const auto& token = tokens[i];
+    void setRecover(bool enabled) {
+        recover = enabled;
+    }
 
-            if (token.type == ChessTokenType::VAR_BEGIN) {
-                if (pdaStack.empty()) {
-                    pdaStack.push_back({1, MoveState::EXPECT_NUMBER});
+    // ---- Streaming core ----
+    // The PDA consumes one token at a time: validateSyntax below is a thin
+    // loop over feedToken, and live-feed sessions call feedToken directly as
+    // moves arrive. Between calls only a two-token lookbehind and a deferred
+    // checkmate flag are kept, so per-session state stays O(stack depth).
+    void beginGame() {
+        resetPDA();
+        fedCount = 0;
+        prev1Type = ChessTokenType::INVALID;
+        prev2Type = ChessTokenType::INVALID;
+        prev1Position = 0;
+        prev1Length = 0;
+        prev1Value = string_view();
+        touchingErrorFound = false;
+        pendingCheckmate = false;
+        pendingCheckmatePos = 0;
+        pendingCheckmateValue = string_view();
+        failed = false;
+        resyncing = false;
+        errorFound = false;
+    }
+
+    bool sessionValid() const {
+        return !errorFound && !touchingErrorFound;
+    }
+
+    // Feeds one token into the PDA; END_OF_INPUT runs the end-of-game
+    // checks. Returns the validity of the game so far.
+    bool feedToken(const ChessToken& token, ValidationReport* report = nullptr) {
+        // Annotation-family tokens carry no grammatical weight: they pass
+        // through without touching the PDA or the lookbehind window (suffix
+        // annotations legitimately touch the move they decorate).
+        if (token.type == ChessTokenType::COMMENT ||
+            token.type == ChessTokenType::NAG ||
+            token.type == ChessTokenType::ANNOTATION) {
+            return sessionValid();
+        }
+
+        // Adjacency check, mirroring the old whole-vector pre-pass: only the
+        // first physically touching pair is reported.
+        if (!touchingErrorFound && fedCount > 0 &&
+            isPrimaryMove(prev1Type) && isPrimaryMove(token.type) &&
+            prev1Position + (int)prev1Length == token.position) {
+            if (verbose) cout << "SYNTAX ERROR: Primary move tokens found **physically touching** in input: '"
+                 << prev1Value << "' at pos " << prev1Position << " followed by '"
+                 << token.value << "' at pos " << token.position << ". Tokens must be separated by space/number.\n";
+            recordError(report, ValidationErrorCode::TOKENS_TOUCHING, token.position);
+            touchingErrorFound = true;
+        }
+
+        if (!failed) {
+            processToken(token, report);
+        }
+
+        prev2Type = prev1Type;
+        prev1Type = token.type;
+        prev1Position = token.position;
+        prev1Length = token.value.length();
+        prev1Value = token.value;
+        fedCount++;
+        return sessionValid();
+    }
+
+    bool validateSyntax(const vector<ChessToken>& tokens, ValidationReport* report = nullptr) {
+        if (verbose) cout << "\n=== SYNTACTIC VALIDATION ===\n";
+
+        beginGame();
+        for (const auto& token : tokens) {
+            feedToken(token, report);
+        }
+
+        if (sessionValid()) {
+            if (verbose) cout << "Syntactic Validation Passed: No syntax errors detected in token sequence.\n";
+        }
+        return sessionValid();
+    }
+
+    // SoA counterpart: walks the parallel arrays, reconstructing each
+    // token's value view from the input buffer only at the moment it is
+    // fed, so the pass is dominated by the one-byte type reads.
+    bool validateSyntaxStream(const TokenStream& stream, string_view input,
+                              ValidationReport* report = nullptr) {
+        if (verbose) cout << "\n=== SYNTACTIC VALIDATION ===\n";
+
+        beginGame();
+        for (size_t i = 0; i < stream.size(); i++) {
+            feedToken(stream.get(i, input), report);
+        }
+
+        if (sessionValid()) {
+            if (verbose) cout << "Syntactic Validation Passed: No syntax errors detected in token sequence.\n";
+        }
+        return sessionValid();
+    }
+
+private:
+    void processToken(const ChessToken& token, ValidationReport* report) {
+        // Resynchronization hunt: skip everything until the next MOVE_NUMBER,
+        // then restart the PDA there, adopting that number as the expected
+        // one. END_OF_INPUT ends the hunt quietly — the game is already
+        // marked invalid.
+        if (resyncing) {
+            if (token.type == ChessTokenType::END_OF_INPUT) {
+                return;
+            }
+            if (token.type != ChessTokenType::MOVE_NUMBER) {
+                return;
+            }
+            string numberStr(token.value.substr(0, token.value.length() - 1));
+            int moveNumber = 0;
+            try {
+                moveNumber = stoi(numberStr);
+            } catch (...) {
+                return;  // keep hunting
+            }
+            resetPDA();
+            pendingCheckmate = false;
+            pdaStack.back().expectedMoveNumber = moveNumber + 1;
+            pdaStack.back().currentState = MoveState::EXPECT_WHITE_MOVE;
+            resyncing = false;
+            return;
+        }
+
+        // A top-level checkmate must be followed by a result or a variation;
+        // the check is deferred to the next fed token (END_OF_INPUT counts).
+        if (pendingCheckmate) {
+            if (token.type == ChessTokenType::RESULT || token.type == ChessTokenType::VAR_BEGIN) {
+                pendingCheckmate = false;
+            } else {
+                if (verbose) cout << "SEQUENCE ERROR: Checkmate (" << pendingCheckmateValue
+                     << ") must be followed immediately by a game RESULT (e.g., 1-0 or 0-1) at end of input.\n";
+                recordError(report, ValidationErrorCode::CHECKMATE_WITHOUT_RESULT, pendingCheckmatePos);
+                flagError();
+                return;
+            }
+        }
+
+        if (token.type == ChessTokenType::VAR_BEGIN) {
+            if (pdaStack.empty()) {
+                pdaStack.push_back({1, MoveState::EXPECT_NUMBER});
+            }
+            pdaStack.push_back(pdaStack.back());
+            CHESSNOT_STAT(tlsStats.pdaHighWater = max(tlsStats.pdaHighWater, (uint64_t)pdaStack.size()));
+            if (pdaStack.size() > 1) {
+                MoveState parentLastKnownState = pdaStack[pdaStack.size() - 2].lastKnownState;
+                if (parentLastKnownState == MoveState::EXPECT_BLACK_MOVE) {
+                    pdaStack.back().currentState = MoveState::EXPECT_BLACK_MOVE;
                 }
-                pdaStack.push_back(pdaStack.back());
-                if (pdaStack.size() > 1) {
-                    MoveState parentLastKnownState = pdaStack[pdaStack.size() - 2].lastKnownState;
-                    if (parentLastKnownState == MoveState::EXPECT_BLACK_MOVE) {
-                        pdaStack.back().currentState = MoveState::EXPECT_BLACK_MOVE;
-                    }
-                    if (parentLastKnownState == MoveState::EXPECT_WHITE_MOVE) {
-                        pdaStack.back().currentState = MoveState::EXPECT_WHITE_MOVE;
-                    }
+                if (parentLastKnownState == MoveState::EXPECT_WHITE_MOVE) {
+                    pdaStack.back().currentState = MoveState::EXPECT_WHITE_MOVE;
                 }
-                continue;
             }
+            return;
+        }
 
-            if (token.type == ChessTokenType::VAR_END) {
-                if (pdaStack.size() <= 1) {
-                    cout << "SEQUENCE ERROR: Unmatched ')' variation end at pos " << token.position << ".\n";
-                    return false;
-                }
-                pdaStack.pop_back();
-                continue;
+        if (token.type == ChessTokenType::VAR_END) {
+            if (pdaStack.size() <= 1) {
+                if (verbose) cout << "SEQUENCE ERROR: Unmatched ')' variation end at pos " << token.position << ".\n";
+                recordError(report, ValidationErrorCode::UNMATCHED_VAR_END, token.position);
+                flagError();
+                return;
             }
+            pdaStack.pop_back();
+            return;
+        }
+
+        if (token.type == ChessTokenType::END_OF_INPUT) {
+            if (pdaStack.size() > 1) {
+                if (verbose) cout << "SEQUENCE ERROR: Unclosed variation(s) — missing ')' at pos " << token.position << ".\n";
+                recordError(report, ValidationErrorCode::UNCLOSED_VARIATION, token.position);
+                flagError();
+                return;
+            }
+            if (pdaStack.back().currentState == MoveState::EXPECT_NUMBER || pdaStack.back().currentState == MoveState::EXPECT_WHITE_MOVE || pdaStack.back().currentState == MoveState::EXPECT_BLACK_MOVE) {
+                if (verbose) cout << "SEQUENCE ERROR: Incomplete game — missing result at end of input.\n";
+                recordError(report, ValidationErrorCode::MISSING_RESULT, token.position);
+                flagError();
+                return;
+            }
+            return;
+        }
 
-            if (token.type == ChessTokenType::END_OF_INPUT) { 
+        if (pdaStack.back().currentState == MoveState::GAME_OVER) {
+            if (verbose) cout << "SEQUENCE ERROR: Tokens found after game termination at pos " << token.position << ".\n";
+            recordError(report, ValidationErrorCode::TOKENS_AFTER_RESULT, token.position);
+            flagError();
+            return;
+        }
+
+        if (token.type == ChessTokenType::RESULT) {
+            if (fedCount > 0 && prev1Type == ChessTokenType::MOVE_NUMBER) {
+                if (verbose) cout << "SEQUENCE ERROR: Found RESULT (" << token.value
+                     << ") immediately after MOVE_NUMBER without moves at pos " << token.position << ".\n";
+                recordError(report, ValidationErrorCode::RESULT_AFTER_MOVE_NUMBER, token.position);
+                flagError();
+                return;
+            }
+            pdaStack.back().currentState = MoveState::GAME_OVER;
+            return;
+        }
+
+        if (token.type == ChessTokenType::MOVE_NUMBER) {
+            if (fedCount > 0 && prev1Type == ChessTokenType::VAR_END) {
+                return;
+            }
+            if (fedCount > 0 && prev1Type == ChessTokenType::VAR_BEGIN) {
+                return;
+            }
+            if (pdaStack.back().currentState != MoveState::EXPECT_NUMBER) {
+                if (verbose) cout << "SEQUENCE ERROR: Found MOVE_NUMBER (" << token.value << ") but expected a move or result at pos " << token.position << ".\n";
+                recordError(report, ValidationErrorCode::UNEXPECTED_MOVE_NUMBER, token.position);
+                flagError();
+                return;
+            }
+
+            string numberStr(token.value.substr(0, token.value.length() - 1));
+            int moveNumber = 0;
+            try {
+                moveNumber = stoi(numberStr);
+            } catch (...) {
+                recordError(report, ValidationErrorCode::BAD_MOVE_NUMBER_VALUE, token.position);
+                flagError();
+                return;
+            }
+
+            if (moveNumber != pdaStack.back().expectedMoveNumber) {
+                if (verbose) cout << "SEQUENCE ERROR: Expected move number " << pdaStack.back().expectedMoveNumber
+                     << " but found " << moveNumber << "at pos " << token.position << ".\n";
+                recordError(report, ValidationErrorCode::WRONG_MOVE_NUMBER, token.position);
+                flagError();
+                return;
+            }
+
+            pdaStack.back().expectedMoveNumber++;
+            pdaStack.back().currentState = MoveState::EXPECT_WHITE_MOVE;
+            return;
+        }
+
+        if (isLegalMoveSymbol(token.type)) {
+            if (fedCount > 1 && prev2Type == ChessTokenType::VAR_END && pdaStack.back().currentState == MoveState::EXPECT_NUMBER) {
+                pdaStack.back().expectedMoveNumber++;
+                pdaStack.back().currentState = MoveState::EXPECT_WHITE_MOVE;
+            }
+            if (token.type == ChessTokenType::CHECKMATE) {
                 if (pdaStack.size() > 1) {
-                    cout << "SEQUENCE ERROR: Unclosed variation(s) — missing ')' at pos " << token.position << ".\n";
-                    return false;
-                }
-                if (pdaStack.back().currentState == MoveState::EXPECT_NUMBER || pdaStack.back().currentState == MoveState::EXPECT_WHITE_MOVE || pdaStack.back().currentState == MoveState::EXPECT_BLACK_MOVE) {
-                    cout << "SEQUENCE ERROR: Incomplete game — missing result at end of input.\n";
-                    return false;
+                    return;
                 }
-                break; 
+                pendingCheckmate = true;
+                pendingCheckmatePos = token.position;
+                pendingCheckmateValue = token.value;
             }
 
-            if (pdaStack.back().currentState == MoveState::GAME_OVER) {
-                if (token.type == ChessTokenType::END_OF_INPUT) {
-                    break; 
+            pdaStack.back().lastKnownState = pdaStack.back().currentState;
+
+            if (pdaStack.back().currentState == MoveState::EXPECT_WHITE_MOVE) {
+                pdaStack.back().currentState = MoveState::EXPECT_BLACK_MOVE;
+            } else if (pdaStack.back().currentState == MoveState::EXPECT_BLACK_MOVE) {
+                pdaStack.back().currentState = MoveState::EXPECT_NUMBER;
+            } else {
+                if (verbose) cout << "SEQUENCE ERROR: Found an unexpected move (" << token.value
+                     << ") when expecting move number or result at pos " << token.position << ".\n";
+                recordError(report, ValidationErrorCode::UNEXPECTED_MOVE, token.position);
+                flagError();
+                return;
+            }
+            return;
+        }
+    }
+
+private:
+    void recordError(ValidationReport* report, ValidationErrorCode code, int position) {
+        if (report) {
+            if (!recover || report->errors.size() < ValidationReport::RECOVERY_ERROR_CAP) {
+                report->errors.push_back({code, position});
+            } else {
+                report->errorsTruncated = true;
+            }
+            report->syntaxValid = false;
+        }
+    }
+
+    // In recovery mode an error starts a resync hunt instead of abandoning
+    // the game; either way the game is invalid from here on.
+    void flagError() {
+        errorFound = true;
+        if (recover) {
+            resyncing = true;
+        } else {
+            failed = true;
+        }
+    }
+
+    bool isPrimaryMove(ChessTokenType type) const {
+        return type == ChessTokenType::MOVE_NUMBER ||
+               type == ChessTokenType::PAWN_MOVE ||
+               type == ChessTokenType::PIECE_MOVE ||
+               type == ChessTokenType::TWIN_PIECE_MOVE ||
+               type == ChessTokenType::PAWN_CAPTURE || 
+               type == ChessTokenType::PIECE_CAPTURE ||
+               type == ChessTokenType::TWIN_PIECE_CAPTURE || 
+               type == ChessTokenType::CASTLING || 
+               type == ChessTokenType::PROMOTION ||
+               type == ChessTokenType::PROMOTION_VIA_CAPTURE || 
+               type == ChessTokenType::CHECK ||
+               type == ChessTokenType::CHECKMATE ||
+               type == ChessTokenType::NULL_MOVE ||
+               type == ChessTokenType::RESULT;
+    }
+
+private:
+    void resetPDA() {
+        pdaStack.clear();
+        pdaStack.push_back({ 1, MoveState::EXPECT_NUMBER });
+    }
+};
+
+// ========== INCREMENTAL GAME SESSION ==========
+// Live-feed entry point: a session keeps the lexer position, the validator's
+// PDA stack and the running report alive between calls, so appending one
+// half-move tokenizes and validates only the new suffix instead of
+// re-scanning the whole game. Sessions share one ChessLexer (its DFA tables
+// are read-only during matching); appended chunks must end on a token
+// boundary, which live feeds sending whole moves always do.
+class IncrementalGameSession {
+private:
+    ChessLexer& lexer;
+    ChessSyntacticValidator validator;
+    ValidationReport report;
+    string buffer;      // full movetext so far; positions refer into it
+    size_t consumed;    // lexer position: bytes already tokenized
+
+public:
+    explicit IncrementalGameSession(ChessLexer& sharedLexer)
+        : lexer(sharedLexer), consumed(0) {
+        validator.setVerbose(false);
+        validator.beginGame();
+    }
+
+    // Appends new movetext and validates only the new suffix. Returns the
+    // validity of the game so far (the final end-of-game checks only run in
+    // finish()).
+    bool append(string_view movetext) {
+        buffer.append(movetext);
+        string_view suffix = string_view(buffer).substr(consumed);
+
+        bool hadLexicalError = false;
+        ValidationReport chunkReport;
+        const auto& tokens = lexer.tokenize(suffix, hadLexicalError, &chunkReport);
+
+        // Chunk-relative error positions become game-relative.
+        for (auto error : chunkReport.errors) {
+            error.position += (int)consumed;
+            report.errors.push_back(error);
+        }
+        if (hadLexicalError) report.lexicalValid = false;
+
+        for (const auto& token : tokens) {
+            if (token.type == ChessTokenType::END_OF_INPUT) break;
+            report.tokenCount++;
+            validator.feedToken(ChessToken(token.type, token.value, token.position + (int)consumed), &report);
+        }
+
+        consumed = buffer.length();
+        return report.lexicalValid && validator.sessionValid();
+    }
+
+    // Ends the game: feeds END_OF_INPUT so the end-of-game checks (result
+    // present, variations closed) run, and returns the final report.
+    const ValidationReport& finish() {
+        validator.feedToken(ChessToken(ChessTokenType::END_OF_INPUT, string_view(), (int)buffer.length()), &report);
+        report.syntaxValid = validator.sessionValid();
+        return report;
+    }
+
+    const string& movetext() const {
+        return buffer;
+    }
+};
+
+// ========== COROUTINE LIVE SESSIONS ==========
+// C++20 builds get a coroutine wrapper around IncrementalGameSession: each
+// live game is one suspended coroutine whose frame carries the incremental
+// lexer position and PDA state, so thousands of quiet games cost only their
+// frames — no thread, no stack. feed() resumes the coroutine with the next
+// movetext chunk; finish() resumes it one last time and hands back the
+// final report. C++17 builds compile the file unchanged without this block.
+#if defined(__cpp_impl_coroutine)
+class LiveGameSession {
+public:
+    struct promise_type {
+        string_view pendingChunk;
+        bool finishing = false;
+        bool validSoFar = true;
+        ValidationReport finalReport;
+
+        LiveGameSession get_return_object() {
+            return LiveGameSession(coroutine_handle<promise_type>::from_promise(*this));
+        }
+        suspend_never initial_suspend() noexcept { return {}; }
+        suspend_always final_suspend() noexcept { return {}; }
+        void return_value(ValidationReport report) { finalReport = report; }
+        void unhandled_exception() { terminate(); }
+    };
+
+private:
+    // Awaitable for "the next chunk of movetext": suspends the session
+    // until feed()/finish() resume it.
+    struct ChunkAwaiter {
+        bool validSoFar = true;
+        promise_type* promise = nullptr;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(coroutine_handle<promise_type> handle) noexcept {
+            promise = &handle.promise();
+            promise->validSoFar = validSoFar;
+        }
+        pair<string_view, bool> await_resume() const noexcept {
+            return {promise->pendingChunk, promise->finishing};
+        }
+    };
+
+    coroutine_handle<promise_type> handle;
+
+    explicit LiveGameSession(coroutine_handle<promise_type> h) : handle(h) {}
+
+public:
+    LiveGameSession(LiveGameSession&& other) noexcept : handle(other.handle) {
+        other.handle = nullptr;
+    }
+    LiveGameSession(const LiveGameSession&) = delete;
+    LiveGameSession& operator=(const LiveGameSession&) = delete;
+
+    ~LiveGameSession() {
+        if (handle) handle.destroy();
+    }
+
+    // The session body: co_awaits chunks and streams them into the
+    // incremental session until finish() is signalled.
+    static LiveGameSession start(ChessLexer& lexer) {
+        IncrementalGameSession session(lexer);
+        bool okSoFar = true;
+        for (;;) {
+            auto [chunk, finishing] = co_await ChunkAwaiter{okSoFar};
+            if (finishing) break;
+            okSoFar = session.append(chunk);
+        }
+        co_return session.finish();
+    }
+
+    // Resumes the session with one more chunk; returns validity so far.
+    bool feed(string_view movetext) {
+        handle.promise().pendingChunk = movetext;
+        handle.promise().finishing = false;
+        handle.resume();
+        return handle.promise().validSoFar;
+    }
+
+    const ValidationReport& finish() {
+        if (!handle.done()) {
+            handle.promise().finishing = true;
+            handle.resume();
+        }
+        return handle.promise().finalReport;
+    }
+};
+#endif  // __cpp_impl_coroutine
+
+// ========== MEMORY-MAPPED FILE INGESTION ==========
+// Read-only mapping of a PGN archive. The whole file is exposed as one
+// string_view so game texts can be sliced out and handed to the lexer with
+// no copying; MADV_SEQUENTIAL tells the kernel to read ahead aggressively
+// for the streaming access pattern.
+class MappedFile {
+private:
+    void* mapping;
+    size_t mappedLength;
+
+public:
+    MappedFile() : mapping(nullptr), mappedLength(0) {}
+
+    ~MappedFile() {
+        close();
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const string& filename) {
+        close();
+
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+
+        struct stat fileInfo;
+        if (fstat(fd, &fileInfo) != 0 || fileInfo.st_size == 0) {
+            ::close(fd);
+            return false;
+        }
+
+        void* address = mmap(nullptr, (size_t)fileInfo.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);  // the mapping keeps its own reference
+        if (address == MAP_FAILED) {
+            return false;
+        }
+
+        madvise(address, (size_t)fileInfo.st_size, MADV_SEQUENTIAL);
+        mapping = address;
+        mappedLength = (size_t)fileInfo.st_size;
+        return true;
+    }
+
+    void close() {
+        if (mapping != nullptr) {
+            munmap(mapping, mappedLength);
+            mapping = nullptr;
+            mappedLength = 0;
+        }
+    }
+
+    bool isOpen() const {
+        return mapping != nullptr;
+    }
+
+    string_view contents() const {
+        return string_view((const char*)mapping, mappedLength);
+    }
+};
+
+// Compact game-boundary index: one (offset, length) pair per game, built in
+// a single scan of the mapped archive. Everything else — sequential batch,
+// the parallel engine's work-item list, O(1) seek to game N — is derived
+// from this index without touching the game bytes again.
+struct GameSpan {
+    size_t offset;
+    size_t length;
+};
+
+vector<GameSpan> buildGameIndex(string_view archive) {
+    vector<GameSpan> index;
+    size_t pos = 0;
+    while (pos < archive.length()) {
+        size_t lineEnd = archive.find('\n', pos);
+        if (lineEnd == string_view::npos) lineEnd = archive.length();
+        size_t length = lineEnd - pos;
+        if (length > 0 && archive[pos + length - 1] == '\r') length--;
+        if (length > 0) {
+            index.push_back({pos, length});
+        }
+        pos = lineEnd + 1;
+    }
+    return index;
+}
+
+// Splits a mapped archive into per-game views without copying: one game per
+// non-empty line, matching the layout of sample.pgn.
+vector<string_view> splitGames(string_view archive) {
+    vector<GameSpan> index = buildGameIndex(archive);
+    vector<string_view> games;
+    games.reserve(index.size());
+    for (const GameSpan& span : index) {
+        games.push_back(archive.substr(span.offset, span.length));
+    }
+    return games;
+}
+
+// ========== PGN TAG-PAIR HEADERS ==========
+// Full PGN games open with a tag-pair section ([Event "..."] and friends)
+// that the movetext lexer has no business seeing. The reader below carves a
+// game into a header span and a movetext span, both views into the mapped
+// buffer; individual tag values are only located when a caller actually asks
+// for one, so validation-only jobs pay nothing for headers beyond skipping
+// the lines.
+struct PgnTagSection {
+    string_view raw;  // the tag-pair lines, exactly as mapped
+
+    // Finds the value of one tag by scanning the raw span on demand. Returns
+    // an empty view when the tag is absent or malformed — callers cannot
+    // tell the two apart, which matches how the rest of this file treats
+    // optional input.
+    string_view tag(string_view name) const {
+        size_t pos = 0;
+        while (pos < raw.length()) {
+            size_t open = raw.find('[', pos);
+            if (open == string_view::npos) break;
+            size_t nameStart = open + 1;
+            if (raw.compare(nameStart, name.length(), name) == 0 &&
+                nameStart + name.length() < raw.length() &&
+                raw[nameStart + name.length()] == ' ') {
+                size_t quoteOpen = raw.find('"', nameStart + name.length());
+                if (quoteOpen == string_view::npos) break;
+                size_t quoteClose = raw.find('"', quoteOpen + 1);
+                if (quoteClose == string_view::npos) break;
+                return raw.substr(quoteOpen + 1, quoteClose - quoteOpen - 1);
+            }
+            pos = open + 1;
+        }
+        return string_view();
+    }
+
+    // Seven-tag roster, each lazily resolved through tag().
+    string_view event() const { return tag("Event"); }
+    string_view site() const { return tag("Site"); }
+    string_view date() const { return tag("Date"); }
+    string_view round() const { return tag("Round"); }
+    string_view white() const { return tag("White"); }
+    string_view black() const { return tag("Black"); }
+    string_view result() const { return tag("Result"); }
+};
+
+struct PgnGame {
+    PgnTagSection header;
+    string_view movetext;
+};
+
+// Splits a full-format PGN archive in one pass: a run of '['-prefixed lines
+// starts a new game and becomes its header span, everything up to the next
+// tag section (blank lines included) becomes its movetext span. Headerless
+// games still work — they just carry an empty tag section.
+vector<PgnGame> splitPgnGames(string_view archive) {
+    vector<PgnGame> games;
+    size_t pos = 0;
+    bool inHeader = false;
+    size_t headerStart = 0, headerEnd = 0;
+    size_t moveStart = string_view::npos, moveEnd = 0;
+
+    auto flush = [&]() {
+        if (moveStart != string_view::npos) {
+            PgnGame game;
+            game.header.raw = archive.substr(headerStart, headerEnd - headerStart);
+            game.movetext = archive.substr(moveStart, moveEnd - moveStart);
+            games.push_back(game);
+        }
+        headerStart = headerEnd = 0;
+        moveStart = string_view::npos;
+    };
+
+    while (pos < archive.length()) {
+        size_t lineEnd = archive.find('\n', pos);
+        if (lineEnd == string_view::npos) lineEnd = archive.length();
+        string_view line = archive.substr(pos, lineEnd - pos);
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+        if (!line.empty() && line.front() == '[') {
+            if (!inHeader) {
+                // A fresh tag section closes the previous game.
+                flush();
+                inHeader = true;
+                headerStart = pos;
+            }
+            headerEnd = pos + line.length();
+        } else if (!line.empty()) {
+            inHeader = false;
+            if (moveStart == string_view::npos) moveStart = pos;
+            moveEnd = pos + line.length();
+        }
+        pos = lineEnd + 1;
+    }
+    flush();
+    return games;
+}
+
+// ========== PARALLEL VALIDATION ENGINE ==========
+// Validates independent games across a pool of worker threads. Work items
+// are dealt round-robin into per-thread deques; a worker drains its own
+// deque from the front and, when empty, steals from the back of a victim's,
+// so long games do not stall the rest of the pool the way a static
+// partition would. Each worker owns its lexer and validator (no shared
+// mutable state), and no new work is created at runtime, so a worker may
+// exit once a full scan of every deque comes up empty.
+class ParallelValidationEngine {
+public:
+    struct Summary {
+        size_t gamesProcessed;
+        size_t validGames;
+        size_t invalidGames;
+        Summary() : gamesProcessed(0), validGames(0), invalidGames(0) {}
+    };
+
+    // Index-driven entry point: the game-boundary index doubles as the
+    // work-item list, so callers that already built one pay no extra scan.
+    Summary validateGames(string_view archive, const vector<GameSpan>& index, int numThreads) {
+        vector<string_view> games;
+        games.reserve(index.size());
+        for (const GameSpan& span : index) {
+            games.push_back(archive.substr(span.offset, span.length));
+        }
+        return validateGames(games, numThreads);
+    }
+
+    Summary validateGames(const vector<string_view>& games, int numThreads) {
+        if (numThreads < 1) numThreads = 1;
+        if ((size_t)numThreads > games.size() && !games.empty()) numThreads = (int)games.size();
+
+        struct WorkQueue {
+            deque<size_t> items;
+            mutex lock;
+        };
+        vector<WorkQueue> queues(numThreads);
+        for (size_t i = 0; i < games.size(); i++) {
+            queues[i % numThreads].items.push_back(i);
+        }
+
+        vector<uint8_t> gameValid(games.size(), 0);
+
+        auto worker = [&](int self) {
+            ChessLexer lexer;
+            ChessSyntacticValidator validator;
+            lexer.setVerbose(false);
+            validator.setVerbose(false);
+
+            for (;;) {
+                size_t gameIndex = 0;
+                bool found = false;
+
+                {
+                    lock_guard<mutex> guard(queues[self].lock);
+                    if (!queues[self].items.empty()) {
+                        gameIndex = queues[self].items.front();
+                        queues[self].items.pop_front();
+                        found = true;
+                    }
                 }
-                cout << "SEQUENCE ERROR: Tokens found after game termination at pos " << token.position << ".\n";
-                return false;
+
+                if (!found) {
+                    for (int victim = 0; victim < numThreads && !found; victim++) {
+                        if (victim == self) continue;
+                        lock_guard<mutex> guard(queues[victim].lock);
+                        if (!queues[victim].items.empty()) {
+                            gameIndex = queues[victim].items.back();
+                            queues[victim].items.pop_back();
+                            found = true;
+                        }
+                    }
+                }
+
+                if (!found) {
+                    return;
+                }
+
+                bool hadLexicalError = false;
+                const auto& tokens = lexer.tokenize(games[gameIndex], hadLexicalError);
+                bool syntaxValid = validator.validateSyntax(tokens);
+                gameValid[gameIndex] = (syntaxValid && !hadLexicalError) ? 1 : 0;
             }
-            
-            if (token.type == ChessTokenType::RESULT) {
-                if (i > 0 && tokens[i-1].type == ChessTokenType::MOVE_NUMBER) {
-                    cout << "SEQUENCE ERROR: Found RESULT (" << token.value 
-                         << ") immediately after MOVE_NUMBER without moves at pos " << token.position << ".\n";
-                    return false;
+        };
+
+        vector<thread> pool;
+        for (int t = 0; t < numThreads; t++) {
+            pool.emplace_back(worker, t);
+        }
+        for (auto& t : pool) {
+            t.join();
+        }
+
+        Summary summary;
+        summary.gamesProcessed = games.size();
+        for (uint8_t v : gameValid) {
+            if (v) summary.validGames++; else summary.invalidGames++;
+        }
+        return summary;
+    }
+};
+
+// ========== PIPELINED VALIDATION ENGINE ==========
+// Three decoupled stages — game reader, lexer pool, validator pool — joined
+// by bounded queues, so splitting, tokenize and validateSyntax overlap
+// instead of serializing per game. The queues are mutex+condvar MPMC rather
+// than lock-free rings: with batch granularity the handoff cost is noise
+// next to the lexing work, and it keeps the code reviewable. Token batches
+// live in a fixed pool and cross threads by pointer; a drained batch goes
+// back on the recycle queue with its capacity intact, so steady state does
+// no allocation anywhere in the pipeline.
+template <typename T>
+class BoundedQueue {
+private:
+    deque<T> items;
+    size_t capacity;
+    bool closed;
+    mutex lock;
+    condition_variable notEmpty;
+    condition_variable notFull;
+
+public:
+    explicit BoundedQueue(size_t capacity) : capacity(capacity), closed(false) {}
+
+    // Blocks while the queue is full. Pushing to a closed queue is a
+    // programming error and simply drops the item.
+    void push(T item) {
+        unique_lock<mutex> guard(lock);
+        notFull.wait(guard, [&] { return items.size() < capacity || closed; });
+        if (closed) return;
+        items.push_back(item);
+        notEmpty.notify_one();
+    }
+
+    // Blocks until an item is available; returns false once the queue is
+    // closed and drained, which is each consumer's signal to exit.
+    bool pop(T& item) {
+        unique_lock<mutex> guard(lock);
+        notEmpty.wait(guard, [&] { return !items.empty() || closed; });
+        if (items.empty()) return false;
+        item = items.front();
+        items.pop_front();
+        notFull.notify_one();
+        return true;
+    }
+
+    void close() {
+        lock_guard<mutex> guard(lock);
+        closed = true;
+        notEmpty.notify_all();
+        notFull.notify_all();
+    }
+};
+
+class PipelineValidationEngine {
+public:
+    struct Summary {
+        size_t gamesProcessed;
+        size_t validGames;
+        size_t invalidGames;
+        Summary() : gamesProcessed(0), validGames(0), invalidGames(0) {}
+    };
+
+    Summary validate(string_view archive, int lexerThreads, int validatorThreads) {
+        if (lexerThreads < 1) lexerThreads = 1;
+        if (validatorThreads < 1) validatorThreads = 1;
+
+        struct GameItem {
+            size_t index;
+            string_view movetext;
+        };
+        struct TokenBatch {
+            size_t index;
+            vector<ChessToken> tokens;
+            bool hadLexicalError;
+        };
+
+        // Enough batches that neither pool can starve the other over a
+        // momentary imbalance.
+        const size_t queueDepth = (size_t)(lexerThreads + validatorThreads) * 4;
+        vector<TokenBatch> batchPool(queueDepth * 2);
+        BoundedQueue<GameItem> gameQueue(queueDepth);
+        BoundedQueue<TokenBatch*> batchQueue(queueDepth);
+        BoundedQueue<TokenBatch*> recycleQueue(batchPool.size());
+        for (auto& batch : batchPool) {
+            recycleQueue.push(&batch);
+        }
+
+        atomic<size_t> gamesProcessed(0), validGames(0);
+        atomic<int> lexersRunning(lexerThreads);
+
+        // Stage 1: split the mapped archive and feed game views downstream.
+        thread reader([&] {
+            size_t pos = 0, index = 0;
+            while (pos < archive.length()) {
+                size_t lineEnd = archive.find('\n', pos);
+                if (lineEnd == string_view::npos) lineEnd = archive.length();
+                string_view line = archive.substr(pos, lineEnd - pos);
+                if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+                if (!line.empty()) {
+                    gameQueue.push({index++, line});
                 }
-                pdaStack.back().currentState = MoveState::GAME_OVER; 
-                continue;
+                pos = lineEnd + 1;
             }
-            
-            if (token.type == ChessTokenType::MOVE_NUMBER) {
-                if (i > 0 && tokens[i-1].type == ChessTokenType::VAR_END) {
-                    continue;
+            gameQueue.close();
+        });
+
+        // Stage 2: lexer pool. The last lexer out closes the batch queue.
+        vector<thread> lexers;
+        for (int t = 0; t < lexerThreads; t++) {
+            lexers.emplace_back([&] {
+                ChessLexer lexer;
+                lexer.setVerbose(false);
+                GameItem item;
+                while (gameQueue.pop(item)) {
+                    TokenBatch* batch = nullptr;
+                    if (!recycleQueue.pop(batch)) break;
+                    batch->index = item.index;
+                    lexer.tokenizeInto(item.movetext, batch->tokens, batch->hadLexicalError);
+                    batchQueue.push(batch);
                 }
-                if (i > 0 && tokens[i-1].type == ChessTokenType::VAR_BEGIN) {
-                    continue;
+                if (--lexersRunning == 0) {
+                    batchQueue.close();
                 }
-                if (pdaStack.back().currentState != MoveState::EXPECT_NUMBER) {
-                    cout << "SEQUENCE ERROR: Found MOVE_NUMBER (" << token.value << ") but expected a move or result at pos " << token.position << ".\n";
-                    return false;
+            });
+        }
+
+        // Stage 3: validator pool.
+        vector<thread> validators;
+        for (int t = 0; t < validatorThreads; t++) {
+            validators.emplace_back([&] {
+                ChessSyntacticValidator validator;
+                validator.setVerbose(false);
+                TokenBatch* batch = nullptr;
+                while (batchQueue.pop(batch)) {
+                    bool syntaxValid = validator.validateSyntax(batch->tokens);
+                    bool valid = syntaxValid && !batch->hadLexicalError;
+                    gamesProcessed++;
+                    if (valid) validGames++;
+                    recycleQueue.push(batch);
                 }
+            });
+        }
+
+        reader.join();
+        for (auto& worker : lexers) worker.join();
+        for (auto& worker : validators) worker.join();
+        recycleQueue.close();
+
+        Summary summary;
+        summary.gamesProcessed = gamesProcessed;
+        summary.validGames = validGames;
+        summary.invalidGames = summary.gamesProcessed - summary.validGames;
+        return summary;
+    }
+};
+
+// ========== REGRESSION REPLAY ==========
+// Catches per-class latency regressions rather than aggregate ones: each
+// game is bucketed by what it stresses (variation nesting -> pdaStack,
+// annotation density -> the comment scanner, raw length -> the token arena),
+// per-game wall time goes into an HDR-style log-bucketed histogram per
+// class, and p50/p99/p999 are diffed against a stored baseline with a
+// failure threshold. The live service budgets 2ms at p99 per append; this
+// is how changes to this file stay honest against it.
+enum class ReplayCategory { NESTED, ANNOTATED, LONG, PLAIN };
+
+constexpr int REPLAY_CATEGORY_COUNT = (int)ReplayCategory::PLAIN + 1;
+
+inline const char* replayCategoryName(ReplayCategory category) {
+    switch (category) {
+        case ReplayCategory::NESTED:    return "nested";
+        case ReplayCategory::ANNOTATED: return "annotated";
+        case ReplayCategory::LONG:      return "long";
+        case ReplayCategory::PLAIN:     return "plain";
+    }
+    return "unknown";
+}
+
+inline ReplayCategory replayCategoryOf(string_view game) {
+    if (game.find('(') != string_view::npos) return ReplayCategory::NESTED;
+    if (game.find('{') != string_view::npos ||
+        game.find('$') != string_view::npos) return ReplayCategory::ANNOTATED;
+    if (game.length() >= 120) return ReplayCategory::LONG;
+    return ReplayCategory::PLAIN;
+}
+
+// Log-bucketed latency histogram in the HDR style: 32 linear sub-buckets
+// per power of two, so relative error stays under ~3% from nanoseconds to
+// seconds while the whole histogram is a few KB of counters. record() is a
+// couple of bit operations — cheap enough to sit inside the timed loop.
+struct LatencyHistogram {
+    static const int SUB_BUCKET_BITS = 5;
+    static const int SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+
+    vector<uint64_t> counts;
+    uint64_t totalCount;
+
+    LatencyHistogram() : counts((64 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT, 0),
+                         totalCount(0) {}
+
+    static int bucketIndexFor(uint64_t nanos) {
+        if (nanos < SUB_BUCKET_COUNT) return (int)nanos;
+        int exponent = 63 - __builtin_clzll(nanos);
+        int shift = exponent - SUB_BUCKET_BITS;
+        int sub = (int)((nanos >> shift) & (SUB_BUCKET_COUNT - 1));
+        return ((shift + 1) << SUB_BUCKET_BITS) + sub;
+    }
+
+    // Lower bound of a bucket; quantiles are reported as this value, so
+    // they are conservative by at most one sub-bucket width.
+    static uint64_t bucketValueFor(int index) {
+        if (index < SUB_BUCKET_COUNT) return (uint64_t)index;
+        int shift = (index >> SUB_BUCKET_BITS) - 1;
+        int sub = index & (SUB_BUCKET_COUNT - 1);
+        return (uint64_t)(SUB_BUCKET_COUNT + sub) << shift;
+    }
+
+    void record(uint64_t nanos) {
+        counts[bucketIndexFor(nanos)]++;
+        totalCount++;
+    }
+
+    uint64_t quantile(double q) const {
+        if (totalCount == 0) return 0;
+        uint64_t target = (uint64_t)(q * totalCount);
+        if (target >= totalCount) target = totalCount - 1;
+        uint64_t seen = 0;
+        for (size_t i = 0; i < counts.size(); i++) {
+            seen += counts[i];
+            if (seen > target) return bucketValueFor((int)i);
+        }
+        return bucketValueFor((int)counts.size() - 1);
+    }
+};
+
+// Replays a categorized corpus and enforces the latency baseline. With no
+// baseline on disk the run records one; subsequent runs fail (non-zero
+// exit) when any category's p50/p99/p999 exceeds the stored value by more
+// than the threshold percentage, which is how this tool slots into CI.
+class RegressionReplayTool {
+private:
+    using Clock = chrono::steady_clock;
 
-                string numberStr = token.value.substr(0, token.value.length() - 1);
-                int moveNumber = 0;
-                try {
-                    moveNumber = stoi(numberStr);
-                } catch (...) {
-                    return false;
-                } 
-
-                if (moveNumber != pdaStack.back().expectedMoveNumber) {
-                    cout << "SEQUENCE ERROR: Expected move number " << pdaStack.back().expectedMoveNumber 
-                         << " but found " << moveNumber << "at pos " << token.position << ".\n";
-                    return false;
+    static uint64_t nanos(Clock::duration d) {
+        return (uint64_t)chrono::duration_cast<chrono::nanoseconds>(d).count();
+    }
+
+public:
+    bool run(const string& filename, const string& baselinePath, double thresholdPct,
+             int repetitions) {
+        MappedFile file;
+        if (!file.open(filename)) {
+            cerr << "Could not open or map \"" << filename << "\".\n";
+            return false;
+        }
+
+        vector<string_view> games = splitGames(file.contents());
+        if (games.empty()) {
+            cerr << "No games found in \"" << filename << "\".\n";
+            return false;
+        }
+
+        vector<ReplayCategory> categories(games.size());
+        size_t categoryGames[REPLAY_CATEGORY_COUNT] = {0};
+        for (size_t i = 0; i < games.size(); i++) {
+            categories[i] = replayCategoryOf(games[i]);
+            categoryGames[(int)categories[i]]++;
+        }
+
+        ChessLexer lexer;
+        ChessSyntacticValidator validator;
+        lexer.setVerbose(false);
+        validator.setVerbose(false);
+
+        // Untimed warmup: touches every page and sizes the token arena, as
+        // in BenchmarkHarness, so the first timed pass is not measuring
+        // page faults.
+        for (string_view game : games) {
+            bool hadLexicalError = false;
+            validator.validateSyntax(lexer.tokenize(game, hadLexicalError));
+        }
+
+        LatencyHistogram histograms[REPLAY_CATEGORY_COUNT];
+        for (int rep = 0; rep < repetitions; rep++) {
+            for (size_t i = 0; i < games.size(); i++) {
+                bool hadLexicalError = false;
+                auto t0 = Clock::now();
+                validator.validateSyntax(lexer.tokenize(games[i], hadLexicalError));
+                histograms[(int)categories[i]].record(nanos(Clock::now() - t0));
+            }
+        }
+
+        cout << "\n=== REGRESSION REPLAY: " << filename << " ===\n";
+        cout << "Games: " << games.size() << ", repetitions: " << repetitions
+             << ", threshold: " << thresholdPct << "%\n";
+
+        // Baseline file: one "category p50 p99 p999" line per category, in
+        // nanoseconds. Absent categories are skipped on both sides.
+        map<string, vector<uint64_t>> baseline;
+        {
+            ifstream in(baselinePath);
+            string name;
+            uint64_t p50, p99, p999;
+            while (in >> name >> p50 >> p99 >> p999) {
+                baseline[name] = {p50, p99, p999};
+            }
+        }
+
+        static const double QUANTILES[3] = {0.50, 0.99, 0.999};
+        static const char* QUANTILE_NAMES[3] = {"p50", "p99", "p999"};
+
+        bool regressed = false;
+        for (int c = 0; c < REPLAY_CATEGORY_COUNT; c++) {
+            if (histograms[c].totalCount == 0) continue;
+            const char* name = replayCategoryName((ReplayCategory)c);
+            cout << "\n" << name << " (" << categoryGames[c] << " game(s), "
+                 << histograms[c].totalCount << " sample(s)):\n";
+
+            auto it = baseline.find(name);
+            for (int q = 0; q < 3; q++) {
+                uint64_t current = histograms[c].quantile(QUANTILES[q]);
+                cout << "  " << QUANTILE_NAMES[q] << "  " << current / 1e3 << " us";
+                if (it != baseline.end()) {
+                    uint64_t allowed =
+                        (uint64_t)(it->second[q] * (1.0 + thresholdPct / 100.0));
+                    cout << "  (baseline " << it->second[q] / 1e3 << " us)";
+                    if (current > allowed) {
+                        cout << "  REGRESSION";
+                        regressed = true;
+                    }
                 }
+                cout << "\n";
+            }
+        }
 
-                pdaStack.back().expectedMoveNumber++;
-                pdaStack.back().currentState = MoveState::EXPECT_WHITE_MOVE;
-                continue; 
+        if (baseline.empty()) {
+            ofstream out(baselinePath);
+            if (!out.is_open()) {
+                cerr << "Could not write baseline to \"" << baselinePath << "\".\n";
+                return false;
             }
-            
-            if (isLegalMoveSymbol(token.type)) {
-                if (i > 1 && tokens[i-2].type == ChessTokenType::VAR_END && pdaStack.back().currentState == MoveState::EXPECT_NUMBER) {
-                    pdaStack.back().expectedMoveNumber++;
-                    pdaStack.back().currentState = MoveState::EXPECT_WHITE_MOVE;
+            for (int c = 0; c < REPLAY_CATEGORY_COUNT; c++) {
+                if (histograms[c].totalCount == 0) continue;
+                out << replayCategoryName((ReplayCategory)c);
+                for (int q = 0; q < 3; q++) {
+                    out << " " << histograms[c].quantile(QUANTILES[q]);
                 }
-                if (token.type == ChessTokenType::CHECKMATE) {
-                    if (pdaStack.size() > 1) {
-                        continue;
-                    } else if (i + 1 < tokens.size() && tokens[i+1].type == ChessTokenType::RESULT || i + 1 < tokens.size() && tokens[i+1].type == ChessTokenType::VAR_BEGIN) {
-                    } else {
-                        cout << "SEQUENCE ERROR: Checkmate (" << token.value 
-                             << ") must be followed immediately by a game RESULT (e.g., 1-0 or 0-1) at end of input.\n";
-                        return false;
+                out << "\n";
+            }
+            cout << "\nNo baseline found; recorded one at " << baselinePath << ".\n";
+            return true;
+        }
+
+        cout << "\n" << (regressed ? "FAIL: latency regression past threshold.\n"
+                                    : "PASS: all quantiles within threshold.\n");
+        return !regressed;
+    }
+};
+
+// ========== SHARDED VALIDATION ==========
+// Multi-process scale-out for archives too large for one box: the archive is
+// split into shardCount contiguous byte ranges aligned on game boundaries,
+// each shard is validated by its own process — forked locally by the
+// coordinator, or launched per-machine with --shard i/N — and the per-shard
+// summaries merge into a single file. Shards share nothing but the read-only
+// mapping, so throughput scales linearly with the number of workers.
+struct ShardSummary {
+    int shardIndex;
+    int shardCount;
+    size_t gamesProcessed;
+    size_t validGames;
+    size_t invalidGames;
+    size_t errorCounts[VALIDATION_ERROR_CODE_COUNT];  // histogram by error code
+
+    ShardSummary() : shardIndex(0), shardCount(1), gamesProcessed(0),
+                     validGames(0), invalidGames(0) {
+        memset(errorCounts, 0, sizeof(errorCounts));
+    }
+
+    void merge(const ShardSummary& other) {
+        gamesProcessed += other.gamesProcessed;
+        validGames += other.validGames;
+        invalidGames += other.invalidGames;
+        for (int c = 0; c < VALIDATION_ERROR_CODE_COUNT; c++) {
+            errorCounts[c] += other.errorCounts[c];
+        }
+    }
+
+    // Summary files are line-oriented key/value text so shards produced on
+    // different machines can be merged with nothing fancier than scp.
+    void write(ostream& out) const {
+        out << "shard " << shardIndex << "/" << shardCount << "\n";
+        out << "games " << gamesProcessed << "\n";
+        out << "valid " << validGames << "\n";
+        out << "invalid " << invalidGames << "\n";
+        for (int c = 0; c < VALIDATION_ERROR_CODE_COUNT; c++) {
+            if (errorCounts[c] == 0) continue;
+            out << "error " << validationErrorCodeName((ValidationErrorCode)c)
+                << " " << errorCounts[c] << "\n";
+        }
+    }
+
+    static bool read(const string& path, ShardSummary& summary) {
+        ifstream in(path);
+        if (!in.is_open()) return false;
+        string key;
+        while (in >> key) {
+            if (key == "shard") {
+                char slash;
+                in >> summary.shardIndex >> slash >> summary.shardCount;
+            } else if (key == "games") {
+                in >> summary.gamesProcessed;
+            } else if (key == "valid") {
+                in >> summary.validGames;
+            } else if (key == "invalid") {
+                in >> summary.invalidGames;
+            } else if (key == "error") {
+                string name;
+                size_t count;
+                in >> name >> count;
+                for (int c = 0; c < VALIDATION_ERROR_CODE_COUNT; c++) {
+                    if (name == validationErrorCodeName((ValidationErrorCode)c)) {
+                        summary.errorCounts[c] = count;
                     }
                 }
+            }
+        }
+        return true;
+    }
+};
 
-                pdaStack.back().lastKnownState = pdaStack.back().currentState;
-                
-                if (pdaStack.back().currentState == MoveState::EXPECT_WHITE_MOVE) {
-                    pdaStack.back().currentState = MoveState::EXPECT_BLACK_MOVE;
-                } else if (pdaStack.back().currentState == MoveState::EXPECT_BLACK_MOVE) {
-                    pdaStack.back().currentState = MoveState::EXPECT_NUMBER;
-                } else {
-                    cout << "SEQUENCE ERROR: Found an unexpected move (" << token.value 
-                         << ") when expecting move number or result at pos " << token.position << ".\n";
-                    return false;
-                }
-                continue;
+// Contiguous slice of the boundary index for one shard, cut by cumulative
+// bytes rather than game count so a shard full of long games does not become
+// the straggler. Cuts land exactly on index entries, so no game is split.
+vector<GameSpan> shardSlice(const vector<GameSpan>& index, int shard, int shardCount) {
+    size_t totalBytes = 0;
+    for (const GameSpan& span : index) totalBytes += span.length;
+
+    size_t lower = totalBytes * shard / shardCount;
+    size_t upper = totalBytes * (shard + 1) / shardCount;
+
+    vector<GameSpan> slice;
+    size_t consumed = 0;
+    for (const GameSpan& span : index) {
+        if (consumed >= lower && consumed < upper) slice.push_back(span);
+        consumed += span.length;
+    }
+    return slice;
+}
+
+class ShardValidationEngine {
+public:
+    static string summaryPathFor(const string& filename, int shard) {
+        return filename + ".shard" + to_string(shard) + ".summary";
+    }
+
+    // Validates one shard's slice of the archive. Single-threaded on
+    // purpose: parallelism comes from running one worker process per shard.
+    ShardSummary validateShard(string_view archive, const vector<GameSpan>& index,
+                               int shard, int shardCount) {
+        ChessLexer lexer;
+        ChessSyntacticValidator validator;
+        lexer.setVerbose(false);
+        validator.setVerbose(false);
+
+        ShardSummary summary;
+        summary.shardIndex = shard;
+        summary.shardCount = shardCount;
+
+        for (const GameSpan& span : shardSlice(index, shard, shardCount)) {
+            ValidationReport report;
+            bool hadLexicalError = false;
+            const auto& tokens =
+                lexer.tokenize(archive.substr(span.offset, span.length), hadLexicalError, &report);
+            bool syntaxValid = validator.validateSyntax(tokens, &report);
+
+            summary.gamesProcessed++;
+            if (syntaxValid && !hadLexicalError) {
+                summary.validGames++;
+            } else {
+                summary.invalidGames++;
+            }
+            for (const ValidationError& error : report.errors) {
+                summary.errorCounts[(int)error.code]++;
             }
         }
-        
-        if (!hasErrors) {
-            cout << "Syntactic Validation Passed: No syntax errors detected in token sequence.\n";
+        return summary;
+    }
+
+    // Worker entry point: validates shard i/N of the file and writes its
+    // summary next to the archive, where the coordinator (or the operator
+    // collecting results from a cluster) picks it up.
+    bool runWorker(const string& filename, int shard, int shardCount) {
+        MappedFile file;
+        if (!file.open(filename)) {
+            cerr << "Could not open or map \"" << filename << "\".\n";
+            return false;
+        }
+
+        vector<GameSpan> index = buildGameIndex(file.contents());
+        ShardSummary summary = validateShard(file.contents(), index, shard, shardCount);
+
+        ofstream out(summaryPathFor(filename, shard));
+        if (!out.is_open()) {
+            cerr << "Could not write summary for shard " << shard << ".\n";
+            return false;
         }
-        return !hasErrors;
+        summary.write(out);
+        return true;
     }
 
-private:
-    bool isPrimaryMove(const ChessToken& token) {
-        return token.type == ChessTokenType::MOVE_NUMBER ||
-               token.type == ChessTokenType::PAWN_MOVE ||
-               token.type == ChessTokenType::PIECE_MOVE ||
-               token.type == ChessTokenType::TWIN_PIECE_MOVE ||
-               token.type == ChessTokenType::PAWN_CAPTURE || 
-               token.type == ChessTokenType::PIECE_CAPTURE ||
-               token.type == ChessTokenType::TWIN_PIECE_CAPTURE || 
-               token.type == ChessTokenType::CASTLING || 
-               token.type == ChessTokenType::PROMOTION ||
-               token.type == ChessTokenType::PROMOTION_VIA_CAPTURE || 
-               token.type == ChessTokenType::CHECK ||
-               token.type == ChessTokenType::CHECKMATE ||
-               token.type == ChessTokenType::RESULT;
+    // Coordinator: forks one local worker per shard, waits for all of them,
+    // then merges the per-shard summaries into "<filename>.summary". Cluster
+    // jobs skip this and run --shard i/N directly on each box.
+    bool runCoordinator(const string& filename, int shardCount) {
+        vector<pid_t> workers;
+        for (int shard = 0; shard < shardCount; shard++) {
+            pid_t pid = fork();
+            if (pid < 0) {
+                cerr << "fork failed for shard " << shard << ".\n";
+                return false;
+            }
+            if (pid == 0) {
+                _exit(runWorker(filename, shard, shardCount) ? 0 : 1);
+            }
+            workers.push_back(pid);
+        }
+
+        bool allSucceeded = true;
+        for (pid_t pid : workers) {
+            int status = 0;
+            waitpid(pid, &status, 0);
+            if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) allSucceeded = false;
+        }
+        if (!allSucceeded) {
+            cerr << "One or more shard workers failed; not merging.\n";
+            return false;
+        }
+
+        ShardSummary merged;
+        merged.shardCount = shardCount;
+        for (int shard = 0; shard < shardCount; shard++) {
+            ShardSummary summary;
+            if (!ShardSummary::read(summaryPathFor(filename, shard), summary)) {
+                cerr << "Missing summary for shard " << shard << ".\n";
+                return false;
+            }
+            merged.merge(summary);
+        }
+
+        ofstream out(filename + ".summary");
+        if (!out.is_open()) {
+            cerr << "Could not write merged summary.\n";
+            return false;
+        }
+        merged.write(out);
+
+        cout << "\n=== SHARDED VALIDATION: " << filename << " ===\n";
+        cout << "Shards:          " << shardCount << "\n";
+        cout << "Games processed: " << merged.gamesProcessed << "\n";
+        cout << "Valid games:     " << merged.validGames << "\n";
+        cout << "Invalid games:   " << merged.invalidGames << "\n";
+        for (int c = 0; c < VALIDATION_ERROR_CODE_COUNT; c++) {
+            if (merged.errorCounts[c] == 0) continue;
+            cout << "  " << validationErrorCodeName((ValidationErrorCode)c)
+                 << ": " << merged.errorCounts[c] << "\n";
+        }
+        cout << "Merged summary written to " << filename << ".summary\n";
+        return true;
     }
+};
 
+// ========== BENCHMARK HARNESS ==========
+// Replays a corpus and reports per-stage throughput: full tokenize, the
+// bare matching loop (tryMatchLongest at every recorded token start), and
+// validateSyntax over pre-tokenized games. One untimed warmup pass touches
+// every page and sizes the token arena; each repetition is then timed
+// separately so run-to-run variance is visible.
+class BenchmarkHarness {
 private:
-    void resetPDA() {
-        pdaStack.clear();
-        pdaStack.push_back({ 1, MoveState::EXPECT_NUMBER });
+    using Clock = chrono::steady_clock;
+
+    static double seconds(Clock::duration d) {
+        return chrono::duration_cast<chrono::duration<double>>(d).count();
+    }
+
+    static void reportStage(const char* name, const vector<double>& times,
+                            size_t bytes, size_t tokens) {
+        double best = *min_element(times.begin(), times.end());
+        double sum = 0;
+        for (double t : times) sum += t;
+        double mean = sum / times.size();
+
+        cout << name << ":\n";
+        cout << "  best  " << best * 1e3 << " ms  ("
+             << (bytes / best) / 1e6 << " MB/s, "
+             << (tokens / best) / 1e6 << " Mtokens/s)\n";
+        cout << "  mean  " << mean * 1e3 << " ms over " << times.size() << " rep(s)\n";
+    }
+
+public:
+    void run(const vector<string_view>& corpus, int repetitions) {
+        if (repetitions < 1) repetitions = 1;
+
+        ChessLexer lexer;
+        ChessSyntacticValidator validator;
+        lexer.setVerbose(false);
+        validator.setVerbose(false);
+
+        size_t totalBytes = 0;
+        for (string_view game : corpus) totalBytes += game.length();
+
+        // Warmup pass; also records every token start position per game for
+        // the matcher-only stage.
+        size_t totalTokens = 0;
+        vector<vector<int>> tokenStarts(corpus.size());
+        for (size_t i = 0; i < corpus.size(); i++) {
+            bool hadLexicalError = false;
+            const auto& tokens = lexer.tokenize(corpus[i], hadLexicalError);
+            tokenStarts[i].reserve(tokens.size());
+            for (const auto& token : tokens) {
+                if (token.type == ChessTokenType::END_OF_INPUT) break;
+                tokenStarts[i].push_back(token.position);
+            }
+            totalTokens += tokenStarts[i].size();
+            validator.validateSyntax(tokens);
+        }
+
+        cout << "\n=== BENCHMARK ===\n";
+        cout << "Corpus: " << corpus.size() << " game(s), "
+             << totalBytes / 1e6 << " MB, " << totalTokens << " tokens\n\n";
+
+        vector<double> tokenizeTimes, matchTimes, validateTimes;
+        for (int rep = 0; rep < repetitions; rep++) {
+            // Stage 1: full tokenize (whitespace skip + match + token build).
+            auto t0 = Clock::now();
+            size_t tokenCount = 0;
+            for (string_view game : corpus) {
+                bool hadLexicalError = false;
+                tokenCount += lexer.tokenize(game, hadLexicalError).size() - 1;
+            }
+            tokenizeTimes.push_back(seconds(Clock::now() - t0));
+
+            // Stage 2: bare matching loop at known token starts.
+            t0 = Clock::now();
+            size_t matched = 0;
+            for (size_t i = 0; i < corpus.size(); i++) {
+                for (int start : tokenStarts[i]) {
+                    matched += lexer.tryMatchLongest(corpus[i], start).value.length();
+                }
+            }
+            matchTimes.push_back(seconds(Clock::now() - t0));
+            (void)matched;
+
+            // Stage 3: validation over pre-tokenized games.
+            double validateTotal = 0;
+            for (string_view game : corpus) {
+                bool hadLexicalError = false;
+                const auto& tokens = lexer.tokenize(game, hadLexicalError);
+                auto v0 = Clock::now();
+                validator.validateSyntax(tokens);
+                validateTotal += seconds(Clock::now() - v0);
+            }
+            validateTimes.push_back(validateTotal);
+
+            if (tokenCount != totalTokens) {
+                cout << "[BENCH WARNING] token count drifted between passes\n";
+            }
+        }
+
+        reportStage("tokenize", tokenizeTimes, totalBytes, totalTokens);
+        reportStage("tryMatchLongest", matchTimes, totalBytes, totalTokens);
+        reportStage("validateSyntax", validateTimes, totalBytes, totalTokens);
     }
 };
 
@@ -818,29 +3077,222 @@ class ChessParserSimulator {
 private:
     ChessLexer lexer;
     ChessSyntacticValidator  syntaxValidator;
+    TokenStream tokenStream;  // reused across processInputSoA calls
+    bool verbose;
 
 public:
-    void processInput(const string& input) {
-        cout << "\nPROCESSING: \n\"" << input << "\"\n";
-        cout << "\n";
+    ChessParserSimulator() : verbose(true) {}
+
+    // Quiet mode: no token dump, no banners, no per-error prose — callers
+    // read everything they need from the returned ValidationReport.
+    void setVerbose(bool enabled) {
+        verbose = enabled;
+        lexer.setVerbose(enabled);
+        syntaxValidator.setVerbose(enabled);
+    }
 
-        auto [tokens, hadLexicalError] = lexer.tokenize(input);
-        lexer.displayTokens(tokens);
-        bool syntaxValid = syntaxValidator.validateSyntax(tokens);
-        
-        cout << "\n=== DIAGNOSTIC CHECK ===\n";
-        cout << "Lexical Errors Found: " << (hadLexicalError ? "TRUE" : "FALSE") << "\n";
-        cout << "Syntactic Validity: " << (syntaxValid ? "TRUE" : "FALSE") << "\n";
-        
-        bool overallValid = syntaxValid && !hadLexicalError;
-        
-        cout << "\nRESULT: " << (overallValid ? "VALID (Lexical/Syntax/Sequence)" : "INVALID (Lexical/Syntax/Sequence)") << "\n";
-        if (hadLexicalError) cout << "   - Lexical errors (unrecognized characters) found.\n";
-        if (!syntaxValid) cout << "   - Syntactic errors (token structure and sequence) found.\n";
-        cout << "=======================================\n" << "\n";
+    void setRecover(bool enabled) {
+        lexer.setRecover(enabled);
+        syntaxValidator.setRecover(enabled);
+    }
+
+    void setProfile(GrammarProfile profile) {
+        lexer.setProfile(profile);
+    }
+
+    void setSkipVariations(bool enabled) {
+        lexer.setSkipVariations(enabled);
+    }
+
+    // Batched multi-game entry point over a mapped archive: one scan builds
+    // the boundary index, the report array is sized up front, and every game
+    // is validated through the same reused token arena. Reports line up with
+    // the index, so reports[n] belongs to the game at index[n].
+    vector<ValidationReport> validateBatch(string_view archive) {
+        vector<GameSpan> index = buildGameIndex(archive);
+        vector<ValidationReport> reports(index.size());
+        for (size_t i = 0; i < index.size(); i++) {
+            reports[i] = processInput(archive.substr(index[i].offset, index[i].length));
+        }
+        return reports;
+    }
+
+    // SoA path: lexer fills the parallel-array stream, validator consumes
+    // it. Diagnostics are quiet, as with the fused path.
+    ValidationReport processInputSoA(string_view input) {
+        ValidationReport report;
+        bool hadLexicalError = false;
+
+        lexer.tokenizeStream(input, tokenStream, hadLexicalError, &report);
+        report.tokenCount = tokenStream.size() - 1;  // exclude END_OF_INPUT
+        bool syntaxValid = syntaxValidator.validateSyntaxStream(tokenStream, input, &report);
+        report.lexicalValid = !hadLexicalError;
+        report.syntaxValid = syntaxValid;
+        return report;
+    }
+
+    // Fused single pass: tokens stream from the lexer straight into the
+    // PDA with no intermediate vector. Diagnostics are always quiet here —
+    // there is no token stream left to pretty-print.
+    ValidationReport processInputFused(string_view input) {
+        ValidationReport report;
+        bool hadLexicalError = false;
+
+        syntaxValidator.beginGame();
+        size_t tokenCount = 0;
+        lexer.tokenizeToSink(input, hadLexicalError, &report,
+                             [&](const ChessToken& token) {
+            if (token.type != ChessTokenType::END_OF_INPUT) tokenCount++;
+            syntaxValidator.feedToken(token, &report);
+        });
+
+        report.tokenCount = tokenCount;
+        report.lexicalValid = !hadLexicalError;
+        report.syntaxValid = syntaxValidator.sessionValid();
+        return report;
+    }
+
+    ValidationReport processInput(string_view input) {
+        ValidationReport report;
+
+        if (verbose) {
+            cout << "\nPROCESSING: \n\"" << input << "\"\n";
+            cout << "\n";
+        }
+
+        bool hadLexicalError = false;
+        const auto& tokens = lexer.tokenize(input, hadLexicalError, &report);
+        report.tokenCount = tokens.size() - 1;  // exclude END_OF_INPUT
+        if (verbose) lexer.displayTokens(tokens);
+        bool syntaxValid = syntaxValidator.validateSyntax(tokens, &report);
+        report.lexicalValid = !hadLexicalError;
+        report.syntaxValid = syntaxValid;
+
+#ifdef CHESSNOT_STATS
+        report.stats.dfaSteps = tlsStats.dfaSteps;
+        report.stats.backtrackBytes = tlsStats.backtrackBytes;
+        report.stats.pdaHighWater = tlsStats.pdaHighWater;
+#endif
+
+        if (verbose) {
+            cout << "\n=== DIAGNOSTIC CHECK ===\n";
+            cout << "Lexical Errors Found: " << (hadLexicalError ? "TRUE" : "FALSE") << "\n";
+            cout << "Syntactic Validity: " << (syntaxValid ? "TRUE" : "FALSE") << "\n";
+
+            cout << "\nRESULT: " << (report.valid() ? "VALID (Lexical/Syntax/Sequence)" : "INVALID (Lexical/Syntax/Sequence)") << "\n";
+            if (hadLexicalError) cout << "   - Lexical errors (unrecognized characters) found.\n";
+            if (!syntaxValid) cout << "   - Syntactic errors (token structure and sequence) found.\n";
+            cout << "=======================================\n" << "\n";
+        }
+        return report;
     }
 
 public:
+    // Non-interactive batch path over a memory-mapped archive: every
+    // non-empty line is validated in sequence, with the lexer fed views
+    // straight into the mapped region. No prompts, no per-game copies.
+    void runBatchFromFile(const string& filename, bool quiet = false, bool fused = false,
+                          bool soa = false) {
+        MappedFile file;
+        if (!file.open(filename)) {
+            cerr << "Could not open or map \"" << filename << "\".\n";
+            return;
+        }
+
+        setVerbose(!quiet);
+
+        // Archives whose first printable character is '[' carry tag-pair
+        // headers; carve those off in the same pass and validate only the
+        // movetext spans. Line-per-game archives take the old path.
+        string_view contents = file.contents();
+        size_t firstPrintable = 0;
+        while (firstPrintable < contents.length() && isPgnWhitespace(contents[firstPrintable])) {
+            firstPrintable++;
+        }
+        bool hasHeaders = firstPrintable < contents.length() && contents[firstPrintable] == '[';
+
+        vector<PgnGame> taggedGames;
+        vector<string_view> games;
+        if (hasHeaders) {
+            taggedGames = splitPgnGames(contents);
+            for (const auto& game : taggedGames) {
+                games.push_back(game.movetext);
+            }
+        } else {
+            games = splitGames(contents);
+        }
+
+        if (!quiet) {
+            cout << "\n=== BATCH PROCESSING (mmap): " << filename << " — "
+                 << games.size() << " game(s) ===\n";
+        }
+        for (size_t i = 0; i < games.size(); i++) {
+            if (!quiet) {
+                cout << "\n--- FILE TEST CASE #" << (i + 1) << " ---\n";
+                if (hasHeaders) {
+                    cout << "[" << taggedGames[i].header.white() << " vs "
+                         << taggedGames[i].header.black() << ", "
+                         << taggedGames[i].header.result() << "]\n";
+                }
+            }
+            ValidationReport report = fused ? processInputFused(games[i])
+                                    : soa ? processInputSoA(games[i])
+                                          : processInput(games[i]);
+            if (quiet) {
+                // One machine-readable line per game.
+                cout << "game=" << (i + 1)
+                     << " valid=" << (report.valid() ? 1 : 0)
+                     << " tokens=" << report.tokenCount
+                     << " errors=" << report.errors.size();
+                for (const auto& error : report.errors) {
+                    cout << " " << validationErrorCodeName(error.code) << "@" << error.position;
+                }
+                if (report.errorsTruncated) cout << " ...";
+                cout << "\n";
+            }
+        }
+
+#ifdef CHESSNOT_STATS
+        tlsStats.print(cout);
+#endif
+    }
+
+    void runParallelFromFile(const string& filename, int numThreads) {
+        MappedFile file;
+        if (!file.open(filename)) {
+            cerr << "Could not open or map \"" << filename << "\".\n";
+            return;
+        }
+
+        vector<GameSpan> index = buildGameIndex(file.contents());
+        ParallelValidationEngine engine;
+        auto summary = engine.validateGames(file.contents(), index, numThreads);
+
+        cout << "\n=== PARALLEL VALIDATION: " << filename << " ===\n";
+        cout << "Threads:        " << numThreads << "\n";
+        cout << "Games processed: " << summary.gamesProcessed << "\n";
+        cout << "Valid games:     " << summary.validGames << "\n";
+        cout << "Invalid games:   " << summary.invalidGames << "\n";
+    }
+
+    void runPipelineFromFile(const string& filename, int lexerThreads, int validatorThreads) {
+        MappedFile file;
+        if (!file.open(filename)) {
+            cerr << "Could not open or map \"" << filename << "\".\n";
+            return;
+        }
+
+        PipelineValidationEngine engine;
+        auto summary = engine.validate(file.contents(), lexerThreads, validatorThreads);
+
+        cout << "\n=== PIPELINED VALIDATION: " << filename << " ===\n";
+        cout << "Lexer threads:     " << lexerThreads << "\n";
+        cout << "Validator threads: " << validatorThreads << "\n";
+        cout << "Games processed: " << summary.gamesProcessed << "\n";
+        cout << "Valid games:     " << summary.validGames << "\n";
+        cout << "Invalid games:   " << summary.invalidGames << "\n";
+    }
+
     void runTestsFromFile(const string& filename) {
         ifstream file(filename);
         if (!file.is_open()) {
@@ -870,7 +3322,154 @@ public:
     }
 };
 
-int main() {
+int main(int argc, char* argv[]) {
+    if (argc > 1 && string(argv[1]) == "--emit-tables") {
+        string path = argc > 2 ? argv[2] : "chessNotTables.h";
+        ChessLexer lexer;
+        if (!lexer.emitPrecompiledTables(path)) {
+            return 1;
+        }
+        cout << "Wrote precompiled DFA tables to " << path
+             << ". Rebuild with -DCHESSNOT_PRECOMPILED_TABLES to use them.\n";
+        return 0;
+    }
+
+    if (argc > 2 && string(argv[1]) == "--batch") {
+        bool quiet = false, recoverMode = false, fused = false, soa = false,
+             skipVariations = false;
+        GrammarProfile profile = GrammarProfile::SAN;
+        for (int i = 3; i < argc; i++) {
+            if (string(argv[i]) == "--quiet") quiet = true;
+            if (string(argv[i]) == "--recover") recoverMode = true;
+            if (string(argv[i]) == "--fused") fused = true;
+            if (string(argv[i]) == "--soa") soa = true;
+            if (string(argv[i]) == "--lan") profile = GrammarProfile::LAN;
+            if (string(argv[i]) == "--combined") profile = GrammarProfile::COMBINED;
+            if (string(argv[i]) == "--skip-variations") skipVariations = true;
+        }
+        ChessParserSimulator simulator;
+        simulator.setProfile(profile);
+        simulator.setRecover(recoverMode);
+        simulator.setSkipVariations(skipVariations);
+        simulator.runBatchFromFile(argv[2], quiet, fused, soa);
+        return 0;
+    }
+
+    // Benchmark mode: replays the given archive (default sample.pgn),
+    // replicated until the corpus is large enough for stable numbers.
+    if (argc > 1 && string(argv[1]) == "--bench") {
+        string filename = argc > 2 ? argv[2] : "sample.pgn";
+        int repetitions = argc > 3 ? atoi(argv[3]) : 5;
+
+        MappedFile file;
+        if (!file.open(filename)) {
+            cerr << "Could not open or map \"" << filename << "\".\n";
+            return 1;
+        }
+
+        vector<string_view> games = splitGames(file.contents());
+        if (games.empty()) {
+            cerr << "No games found in \"" << filename << "\".\n";
+            return 1;
+        }
+
+        size_t corpusBytes = 0;
+        for (string_view game : games) corpusBytes += game.length();
+
+        const size_t targetBytes = 16 * 1024 * 1024;
+        vector<string_view> corpus;
+        size_t replicatedBytes = 0;
+        while (replicatedBytes < targetBytes) {
+            for (string_view game : games) corpus.push_back(game);
+            replicatedBytes += corpusBytes;
+        }
+
+        BenchmarkHarness harness;
+        harness.run(corpus, repetitions);
+        return 0;
+    }
+
+    // Live-feed demo: each stdin line is appended to one incremental
+    // session; an empty line (or EOF) ends the game and prints the report.
+    if (argc > 1 && string(argv[1]) == "--live") {
+        ChessLexer lexer;
+        lexer.setVerbose(false);
+#if defined(__cpp_impl_coroutine)
+        LiveGameSession session = LiveGameSession::start(lexer);
+        string line;
+        while (getline(cin, line) && !line.empty()) {
+            bool okSoFar = session.feed(line + " ");
+            cout << "appended, valid_so_far=" << (okSoFar ? 1 : 0) << "\n";
+        }
+#else
+        IncrementalGameSession session(lexer);
+        string line;
+        while (getline(cin, line) && !line.empty()) {
+            bool okSoFar = session.append(line + " ");
+            cout << "appended, valid_so_far=" << (okSoFar ? 1 : 0) << "\n";
+        }
+#endif
+        const ValidationReport& report = session.finish();
+        cout << "final valid=" << (report.valid() ? 1 : 0)
+             << " tokens=" << report.tokenCount
+             << " errors=" << report.errors.size();
+        for (const auto& error : report.errors) {
+            cout << " " << validationErrorCodeName(error.code) << "@" << error.position;
+        }
+        cout << "\n";
+        return 0;
+    }
+
+    // Regression replay: categorizes the corpus, replays it with per-game
+    // timing, and diffs latency quantiles against the stored baseline.
+    if (argc > 2 && string(argv[1]) == "--replay") {
+        string filename = argv[2];
+        string baselinePath = argc > 3 ? argv[3] : filename + ".baseline";
+        double thresholdPct = argc > 4 ? atof(argv[4]) : 25.0;
+        int repetitions = argc > 5 ? atoi(argv[5]) : 5;
+        RegressionReplayTool tool;
+        return tool.run(filename, baselinePath, thresholdPct, repetitions) ? 0 : 1;
+    }
+
+    // Sharded mode: "--shard <file> i/N" validates one contiguous shard and
+    // writes "<file>.shardI.summary"; "--shards <file> N" forks N local
+    // workers and merges their summaries into "<file>.summary".
+    if (argc > 3 && string(argv[1]) == "--shard") {
+        string spec = argv[3];
+        size_t slash = spec.find('/');
+        int shard = atoi(spec.c_str());
+        int shardCount = slash == string::npos ? 0 : atoi(spec.c_str() + slash + 1);
+        if (shardCount < 1 || shard < 0 || shard >= shardCount) {
+            cerr << "Bad shard spec \"" << spec << "\"; expected i/N with 0 <= i < N.\n";
+            return 1;
+        }
+        ShardValidationEngine engine;
+        return engine.runWorker(argv[2], shard, shardCount) ? 0 : 1;
+    }
+
+    if (argc > 2 && string(argv[1]) == "--shards") {
+        int shardCount = argc > 3 ? atoi(argv[3]) : (int)thread::hardware_concurrency();
+        if (shardCount < 1) shardCount = 1;
+        ShardValidationEngine engine;
+        return engine.runCoordinator(argv[2], shardCount) ? 0 : 1;
+    }
+
+    if (argc > 2 && string(argv[1]) == "--parallel") {
+        int numThreads = argc > 3 ? atoi(argv[3]) : (int)thread::hardware_concurrency();
+        ChessParserSimulator simulator;
+        simulator.runParallelFromFile(argv[2], numThreads);
+        return 0;
+    }
+
+    if (argc > 2 && string(argv[1]) == "--pipeline") {
+        int defaultThreads = max(1, (int)thread::hardware_concurrency() / 2);
+        int lexerThreads = argc > 3 ? atoi(argv[3]) : defaultThreads;
+        int validatorThreads = argc > 4 ? atoi(argv[4]) : defaultThreads;
+        ChessParserSimulator simulator;
+        simulator.runPipelineFromFile(argv[2], lexerThreads, validatorThreads);
+        return 0;
+    }
+
     ChessParserSimulator simulator;
     string input;
 
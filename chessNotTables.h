@@ -0,0 +1,873 @@
+// Generated by chessNot --emit-tables. Do not edit by hand;
+// regenerate after any change to the token grammar.
+#pragma once
+#include <cstdint>
+
+namespace chessNotTables {
+
+struct PrecompiledDFATable {
+    int numStates;
+    int numClasses;
+    const uint8_t* byteClass;
+    const int16_t* transitions;
+    const uint8_t* accepting;
+    const int16_t* acceptTag;
+};
+
+inline constexpr uint8_t moveNumber_byteClass[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+    2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+inline constexpr int16_t moveNumber_transitions[] = {
+    -1,-1,1,-1,2,1,-1,3,-1,-1,4,-1,-1,-1,-1,
+};
+inline constexpr uint8_t moveNumber_accepting[] = {
+    0,0,1,0,1,
+};
+inline constexpr int16_t moveNumber_acceptTag[] = {
+    -1,-1,-1,-1,-1,
+};
+inline constexpr PrecompiledDFATable moveNumber = {5, 3, moveNumber_byteClass, moveNumber_transitions, moveNumber_accepting, moveNumber_acceptTag};
+
+inline constexpr uint8_t pawnMove_byteClass[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,2,2,2,2,2,2,2,2,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+inline constexpr int16_t pawnMove_transitions[] = {
+    -1,-1,1,-1,2,-1,-1,-1,-1,
+};
+inline constexpr uint8_t pawnMove_accepting[] = {
+    0,0,1,
+};
+inline constexpr int16_t pawnMove_acceptTag[] = {
+    -1,-1,-1,
+};
+inline constexpr PrecompiledDFATable pawnMove = {3, 3, pawnMove_byteClass, pawnMove_transitions, pawnMove_accepting, pawnMove_acceptTag};
+
+inline constexpr uint8_t pieceMove_byteClass[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,
+    0,0,2,0,0,0,0,0,0,0,0,2,0,0,2,0,
+    0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,3,3,3,3,3,3,3,3,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+inline constexpr int16_t pieceMove_transitions[] = {
+    -1,-1,1,-1,-1,-1,-1,2,-1,3,-1,-1,-1,-1,-1,-1,
+};
+inline constexpr uint8_t pieceMove_accepting[] = {
+    0,0,0,1,
+};
+inline constexpr int16_t pieceMove_acceptTag[] = {
+    -1,-1,-1,-1,
+};
+inline constexpr PrecompiledDFATable pieceMove = {4, 4, pieceMove_byteClass, pieceMove_transitions, pieceMove_accepting, pieceMove_acceptTag};
+
+inline constexpr uint8_t twinPieceMove_byteClass[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,
+    0,0,2,0,0,0,0,0,0,0,0,0,0,0,2,0,
+    0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,3,3,3,3,3,3,3,3,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+inline constexpr int16_t twinPieceMove_transitions[] = {
+    -1,-1,1,-1,-1,2,-1,2,-1,-1,-1,3,-1,4,-1,-1,
+    -1,-1,-1,-1,
+};
+inline constexpr uint8_t twinPieceMove_accepting[] = {
+    0,0,0,0,1,
+};
+inline constexpr int16_t twinPieceMove_acceptTag[] = {
+    -1,-1,-1,-1,-1,
+};
+inline constexpr PrecompiledDFATable twinPieceMove = {5, 4, twinPieceMove_byteClass, twinPieceMove_transitions, twinPieceMove_accepting, twinPieceMove_acceptTag};
+
+inline constexpr uint8_t pawnCapture_byteClass[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,2,2,2,2,2,2,2,2,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+inline constexpr int16_t pawnCapture_transitions[] = {
+    -1,-1,1,-1,-1,-1,-1,2,-1,-1,3,-1,-1,4,-1,-1,
+    -1,-1,-1,-1,
+};
+inline constexpr uint8_t pawnCapture_accepting[] = {
+    0,0,0,0,1,
+};
+inline constexpr int16_t pawnCapture_acceptTag[] = {
+    -1,-1,-1,-1,-1,
+};
+inline constexpr PrecompiledDFATable pawnCapture = {5, 4, pawnCapture_byteClass, pawnCapture_transitions, pawnCapture_accepting, pawnCapture_acceptTag};
+
+inline constexpr uint8_t pieceCapture_byteClass[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,
+    0,0,2,0,0,0,0,0,0,0,0,2,0,0,2,0,
+    0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,3,3,3,3,3,3,3,3,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+inline constexpr int16_t pieceCapture_transitions[] = {
+    -1,-1,1,-1,-1,-1,-1,-1,-1,2,-1,-1,-1,3,-1,-1,
+    4,-1,-1,-1,-1,-1,-1,-1,-1,
+};
+inline constexpr uint8_t pieceCapture_accepting[] = {
+    0,0,0,0,1,
+};
+inline constexpr int16_t pieceCapture_acceptTag[] = {
+    -1,-1,-1,-1,-1,
+};
+inline constexpr PrecompiledDFATable pieceCapture = {5, 5, pieceCapture_byteClass, pieceCapture_transitions, pieceCapture_accepting, pieceCapture_acceptTag};
+
+inline constexpr uint8_t twinPieceCapture_byteClass[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,
+    0,0,2,0,0,0,0,0,0,0,0,0,0,0,2,0,
+    0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,3,3,3,3,3,3,3,3,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+inline constexpr int16_t twinPieceCapture_transitions[] = {
+    -1,-1,1,-1,-1,-1,2,-1,2,-1,-1,-1,-1,-1,3,-1,
+    -1,-1,4,-1,-1,5,-1,-1,-1,-1,-1,-1,-1,-1,
+};
+inline constexpr uint8_t twinPieceCapture_accepting[] = {
+    0,0,0,0,0,1,
+};
+inline constexpr int16_t twinPieceCapture_acceptTag[] = {
+    -1,-1,-1,-1,-1,-1,
+};
+inline constexpr PrecompiledDFATable twinPieceCapture = {6, 5, twinPieceCapture_byteClass, twinPieceCapture_transitions, twinPieceCapture_accepting, twinPieceCapture_acceptTag};
+
+inline constexpr uint8_t castling_byteClass[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+inline constexpr int16_t castling_transitions[] = {
+    -1,-1,1,-1,2,-1,-1,-1,3,-1,4,-1,-1,-1,5,-1,
+    -1,-1,
+};
+inline constexpr uint8_t castling_accepting[] = {
+    0,0,0,1,0,1,
+};
+inline constexpr int16_t castling_acceptTag[] = {
+    -1,-1,-1,-1,-1,-1,
+};
+inline constexpr PrecompiledDFATable castling = {6, 3, castling_byteClass, castling_transitions, castling_accepting, castling_acceptTag};
+
+inline constexpr uint8_t promotion_byteClass[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,0,0,0,0,0,0,1,0,0,0,0,2,0,0,
+    0,0,3,0,0,0,0,0,0,0,0,0,0,0,3,0,
+    0,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,4,4,4,4,4,4,4,4,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+inline constexpr int16_t promotion_transitions[] = {
+    -1,-1,-1,-1,1,-1,2,-1,-1,-1,-1,-1,3,-1,-1,-1,
+    -1,-1,4,-1,-1,-1,-1,-1,-1,
+};
+inline constexpr uint8_t promotion_accepting[] = {
+    0,0,0,0,1,
+};
+inline constexpr int16_t promotion_acceptTag[] = {
+    -1,-1,-1,-1,-1,
+};
+inline constexpr PrecompiledDFATable promotion = {5, 5, promotion_byteClass, promotion_transitions, promotion_accepting, promotion_acceptTag};
+
+inline constexpr uint8_t promotionViaCapture_byteClass[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,0,0,0,0,0,0,1,0,0,0,0,2,0,0,
+    0,0,3,0,0,0,0,0,0,0,0,0,0,0,3,0,
+    0,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,4,4,4,4,4,4,4,4,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+inline constexpr int16_t promotionViaCapture_transitions[] = {
+    -1,-1,-1,-1,1,-1,-1,-1,-1,-1,-1,2,-1,-1,-1,-1,
+    3,-1,-1,4,-1,-1,-1,-1,-1,-1,5,-1,-1,-1,-1,-1,
+    -1,6,-1,-1,-1,-1,-1,-1,-1,-1,
+};
+inline constexpr uint8_t promotionViaCapture_accepting[] = {
+    0,0,0,0,0,0,1,
+};
+inline constexpr int16_t promotionViaCapture_acceptTag[] = {
+    -1,-1,-1,-1,-1,-1,-1,
+};
+inline constexpr PrecompiledDFATable promotionViaCapture = {7, 6, promotionViaCapture_byteClass, promotionViaCapture_transitions, promotionViaCapture_accepting, promotionViaCapture_acceptTag};
+
+inline constexpr uint8_t check_byteClass[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,
+    0,3,4,4,4,4,4,4,3,0,0,0,0,5,0,0,
+    0,0,6,0,0,0,0,0,0,0,0,7,0,0,6,8,
+    0,6,6,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,9,9,9,9,9,9,9,9,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+inline constexpr int16_t check_transitions[] = {
+    -1,-1,-1,-1,-1,-1,1,2,3,4,-1,-1,-1,-1,2,2,
+    -1,-1,-1,-1,5,6,-1,-1,-1,-1,-1,-1,-1,-1,-1,7,
+    6,-1,-1,8,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,9,
+    10,-1,-1,-1,-1,-1,11,-1,-1,-1,10,10,-1,-1,-1,-1,
+    7,6,-1,-1,-1,-1,-1,-1,-1,-1,-1,7,-1,-1,-1,-1,
+    10,10,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    12,-1,-1,-1,13,-1,-1,-1,14,-1,-1,-1,-1,-1,-1,13,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,15,-1,-1,13,16,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    10,-1,-1,-1,-1,-1,-1,-1,9,10,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,10,-1,-1,
+};
+inline constexpr uint8_t check_accepting[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
+    0,
+};
+inline constexpr int16_t check_acceptTag[] = {
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,
+};
+inline constexpr PrecompiledDFATable check = {17, 11, check_byteClass, check_transitions, check_accepting, check_acceptTag};
+
+inline constexpr uint8_t checkmate_byteClass[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,1,0,0,0,0,0,0,0,0,0,2,0,0,
+    0,3,4,4,4,4,4,4,3,0,0,0,0,5,0,0,
+    0,0,6,0,0,0,0,0,0,0,0,7,0,0,6,8,
+    0,6,6,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,9,9,9,9,9,9,9,9,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+inline constexpr int16_t checkmate_transitions[] = {
+    -1,-1,-1,-1,-1,-1,1,2,3,4,-1,-1,-1,-1,2,2,
+    -1,-1,-1,-1,5,6,-1,-1,-1,-1,-1,-1,-1,-1,-1,7,
+    6,-1,-1,8,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,9,
+    10,-1,-1,-1,-1,-1,11,-1,-1,-1,10,10,-1,-1,-1,-1,
+    7,6,-1,-1,-1,-1,-1,-1,-1,-1,-1,7,-1,-1,-1,-1,
+    10,10,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    12,-1,-1,-1,13,-1,-1,-1,14,-1,-1,-1,-1,-1,-1,13,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,15,-1,-1,13,16,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    10,-1,-1,-1,-1,-1,-1,-1,9,10,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,10,-1,-1,
+};
+inline constexpr uint8_t checkmate_accepting[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
+    0,
+};
+inline constexpr int16_t checkmate_acceptTag[] = {
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,
+};
+inline constexpr PrecompiledDFATable checkmate = {17, 11, checkmate_byteClass, checkmate_transitions, checkmate_accepting, checkmate_acceptTag};
+
+inline constexpr uint8_t result_byteClass[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,
+    3,4,5,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+inline constexpr int16_t result_transitions[] = {
+    -1,-1,-1,1,2,-1,-1,3,-1,-1,-1,-1,-1,4,5,-1,
+    -1,-1,-1,-1,-1,-1,6,-1,-1,-1,-1,6,-1,-1,-1,-1,
+    -1,-1,-1,7,-1,-1,-1,-1,-1,-1,-1,8,-1,-1,-1,-1,
+    -1,-1,-1,-1,9,-1,-1,-1,10,-1,-1,-1,-1,-1,-1,-1,
+    -1,6,
+};
+inline constexpr uint8_t result_accepting[] = {
+    0,0,0,0,0,0,1,0,0,0,0,
+};
+inline constexpr int16_t result_acceptTag[] = {
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+};
+inline constexpr PrecompiledDFATable result = {11, 6, result_byteClass, result_transitions, result_accepting, result_acceptTag};
+
+inline constexpr uint8_t varBegin_byteClass[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+inline constexpr int16_t varBegin_transitions[] = {
+    -1,1,-1,-1,
+};
+inline constexpr uint8_t varBegin_accepting[] = {
+    0,1,
+};
+inline constexpr int16_t varBegin_acceptTag[] = {
+    -1,-1,
+};
+inline constexpr PrecompiledDFATable varBegin = {2, 2, varBegin_byteClass, varBegin_transitions, varBegin_accepting, varBegin_acceptTag};
+
+inline constexpr uint8_t varEnd_byteClass[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+inline constexpr int16_t varEnd_transitions[] = {
+    -1,1,-1,-1,
+};
+inline constexpr uint8_t varEnd_accepting[] = {
+    0,1,
+};
+inline constexpr int16_t varEnd_acceptTag[] = {
+    -1,-1,
+};
+inline constexpr PrecompiledDFATable varEnd = {2, 2, varEnd_byteClass, varEnd_transitions, varEnd_accepting, varEnd_acceptTag};
+
+inline constexpr uint8_t nag_byteClass[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+    2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+inline constexpr int16_t nag_transitions[] = {
+    -1,1,-1,-1,-1,2,-1,-1,2,
+};
+inline constexpr uint8_t nag_accepting[] = {
+    0,0,1,
+};
+inline constexpr int16_t nag_acceptTag[] = {
+    -1,-1,-1,
+};
+inline constexpr PrecompiledDFATable nag = {3, 3, nag_byteClass, nag_transitions, nag_accepting, nag_acceptTag};
+
+inline constexpr uint8_t annotation_byteClass[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+inline constexpr int16_t annotation_transitions[] = {
+    -1,1,-1,2,-1,-1,
+};
+inline constexpr uint8_t annotation_accepting[] = {
+    0,1,1,
+};
+inline constexpr int16_t annotation_acceptTag[] = {
+    -1,-1,-1,
+};
+inline constexpr PrecompiledDFATable annotation = {3, 2, annotation_byteClass, annotation_transitions, annotation_accepting, annotation_acceptTag};
+
+inline constexpr uint8_t master_byteClass[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,0,2,3,0,0,0,4,5,0,6,0,7,8,9,
+    10,11,12,13,13,13,13,13,14,15,0,0,0,16,0,1,
+    0,0,17,0,0,0,0,0,0,0,0,18,0,0,17,19,
+    0,17,17,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,20,20,20,20,20,20,20,20,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,21,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+inline constexpr int16_t master_transitions[] = {
+    -1,1,-1,2,3,4,-1,-1,-1,-1,5,6,7,7,7,7,
+    -1,8,9,10,11,-1,-1,12,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,13,13,13,13,13,13,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,14,15,-1,7,7,7,7,7,7,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,16,15,17,7,7,
+    7,7,7,7,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,15,-1,7,7,7,7,7,7,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,18,18,18,18,-1,
+    -1,-1,-1,-1,19,20,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,21,20,-1,-1,-1,-1,
+    -1,-1,-1,22,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,23,24,24,
+    23,-1,-1,-1,-1,-1,-1,25,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,13,13,13,13,13,13,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,26,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,27,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,26,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,28,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    29,30,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,31,31,31,
+    31,-1,-1,-1,-1,-1,29,30,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,32,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,31,31,31,31,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,33,-1,-1,-1,-1,34,-1,-1,-1,
+    35,-1,-1,-1,-1,-1,-1,-1,-1,-1,36,-1,-1,-1,-1,-1,
+    -1,-1,34,-1,-1,-1,35,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,37,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,38,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,39,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,40,40,40,40,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,41,-1,-1,-1,34,-1,-1,-1,
+    35,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,42,42,42,42,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,34,-1,-1,-1,35,43,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,44,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,45,46,46,45,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,47,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,34,-1,-1,-1,35,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,48,48,48,48,-1,-1,-1,-1,-1,-1,-1,-1,-1,34,-1,
+    -1,-1,35,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,49,-1,-1,-1,-1,34,-1,-1,-1,35,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    34,-1,-1,-1,35,-1,-1,-1,-1,-1,-1,-1,-1,-1,50,-1,
+    -1,-1,-1,-1,-1,-1,34,-1,-1,-1,35,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,51,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,34,-1,-1,-1,35,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,34,-1,-1,-1,35,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,52,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,26,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,34,-1,-1,-1,35,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+};
+inline constexpr uint8_t master_accepting[] = {
+    0,1,0,1,1,0,0,0,0,0,0,0,1,1,0,1,
+    0,0,0,0,0,0,0,1,1,0,1,0,0,0,0,1,
+    0,1,1,1,0,0,1,0,1,0,1,0,1,1,1,0,
+    1,1,0,0,1,
+};
+inline constexpr int16_t master_acceptTag[] = {
+    -1,17,-1,13,14,-1,-1,-1,-1,-1,-1,-1,17,16,-1,0,
+    -1,-1,-1,-1,-1,-1,-1,1,1,-1,12,-1,-1,-1,-1,2,
+    -1,7,11,10,-1,-1,0,-1,3,-1,5,-1,8,4,4,-1,
+    6,7,-1,-1,9,
+};
+inline constexpr PrecompiledDFATable master = {53, 22, master_byteClass, master_transitions, master_accepting, master_acceptTag};
+
+inline constexpr uint8_t masterLan_byteClass[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,0,2,3,0,0,0,4,5,0,6,0,7,8,9,
+    10,11,12,13,13,13,13,13,13,14,0,0,0,0,0,1,
+    0,0,15,0,0,0,0,0,0,0,0,15,0,0,15,16,
+    0,15,15,0,0,0,0,0,0,0,17,0,0,0,0,0,
+    0,18,18,18,18,18,18,18,18,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,19,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+inline constexpr int16_t masterLan_transitions[] = {
+    -1,1,-1,2,3,4,-1,5,-1,-1,6,7,8,8,8,9,
+    10,11,12,-1,-1,13,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,14,14,14,14,14,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,15,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,16,
+    17,-1,8,8,8,8,8,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,18,17,19,8,8,8,8,8,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,17,-1,8,8,8,8,8,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,20,-1,-1,-1,-1,-1,-1,-1,-1,21,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,15,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,22,22,22,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,14,14,14,14,14,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,23,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,24,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,23,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,25,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,26,26,26,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,27,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,28,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,29,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,30,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,31,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,32,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,33,-1,-1,34,-1,
+    -1,-1,35,36,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,37,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,38,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,39,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,40,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,41,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    42,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,43,
+    43,43,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,44,44,44,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,45,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,46,46,46,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,47,
+    47,47,-1,-1,-1,-1,-1,-1,-1,-1,34,-1,-1,-1,35,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,34,-1,
+    -1,-1,35,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,34,-1,-1,-1,35,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    23,-1,-1,-1,-1,-1,-1,-1,-1,-1,34,-1,-1,-1,35,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,34,-1,
+    -1,-1,35,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+};
+inline constexpr uint8_t masterLan_accepting[] = {
+    0,1,0,1,1,0,0,0,0,0,0,0,0,1,1,1,
+    0,1,0,0,0,0,0,1,0,0,0,1,0,0,1,0,
+    0,0,1,1,0,0,0,0,0,0,1,1,1,0,1,1,
+};
+inline constexpr int16_t masterLan_acceptTag[] = {
+    -1,17,-1,13,14,-1,-1,-1,-1,-1,-1,-1,-1,17,16,18,
+    -1,0,-1,-1,-1,-1,-1,12,-1,-1,-1,7,-1,-1,0,-1,
+    -1,-1,11,10,-1,-1,-1,-1,-1,-1,7,1,4,-1,2,5,
+};
+inline constexpr PrecompiledDFATable masterLan = {48, 20, masterLan_byteClass, masterLan_transitions, masterLan_accepting, masterLan_acceptTag};
+
+inline constexpr uint8_t masterCombined_byteClass[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,0,2,3,0,0,0,4,5,0,6,0,7,8,9,
+    10,11,12,13,13,13,13,13,14,15,0,0,0,16,0,1,
+    0,0,17,0,0,0,0,0,0,0,0,18,0,0,17,19,
+    0,17,17,0,0,0,0,0,0,0,20,0,0,0,0,0,
+    0,21,21,21,21,21,21,21,21,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+inline constexpr int16_t masterCombined_transitions[] = {
+    -1,1,-1,2,3,4,-1,5,-1,-1,6,7,8,8,8,8,
+    -1,9,10,11,12,13,-1,-1,14,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,15,15,15,15,15,15,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,16,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,17,18,-1,8,8,8,8,8,8,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,19,18,20,8,8,8,8,8,
+    8,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    18,-1,8,8,8,8,8,8,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,21,21,21,21,-1,-1,
+    -1,-1,-1,-1,22,23,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,24,23,-1,-1,-1,
+    -1,-1,-1,-1,25,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,16,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,26,27,27,26,-1,-1,-1,-1,-1,-1,
+    -1,28,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,15,15,15,15,15,15,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,29,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,30,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,29,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,31,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,32,33,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,34,34,34,34,-1,-1,-1,-1,-1,-1,32,
+    33,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,35,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,34,34,34,34,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,36,-1,-1,-1,-1,-1,37,-1,-1,-1,38,39,-1,-1,
+    -1,-1,-1,-1,-1,-1,40,-1,-1,-1,-1,-1,41,-1,-1,37,
+    -1,-1,-1,38,39,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,41,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,42,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,43,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    44,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,45,45,45,45,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,46,-1,-1,-1,
+    37,-1,-1,-1,38,47,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,23,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    48,48,48,48,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,37,-1,
+    -1,-1,38,49,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,50,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,51,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,52,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,53,54,54,53,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,55,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,37,-1,-1,
+    -1,38,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,56,56,56,
+    56,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,57,-1,
+    -1,-1,37,-1,-1,-1,38,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,58,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,59,59,59,59,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,37,-1,-1,-1,38,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,54,54,54,54,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,37,-1,-1,-1,38,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,60,-1,-1,-1,-1,-1,-1,-1,-1,37,-1,-1,-1,
+    38,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,61,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,37,-1,-1,-1,38,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,62,62,62,62,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,37,-1,-1,-1,38,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,37,
+    -1,-1,-1,38,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,29,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,37,-1,-1,-1,38,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,37,-1,-1,-1,38,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+};
+inline constexpr uint8_t masterCombined_accepting[] = {
+    0,1,0,1,1,0,0,0,0,0,0,0,0,0,1,1,
+    1,0,1,0,0,0,0,0,0,0,1,1,0,1,0,0,
+    0,0,1,0,1,1,1,0,0,0,0,1,0,1,0,0,
+    1,0,0,1,0,1,1,0,1,0,1,1,0,0,1,1,
+};
+inline constexpr int16_t masterCombined_acceptTag[] = {
+    -1,17,-1,13,14,-1,-1,-1,-1,-1,-1,-1,-1,-1,17,16,
+    18,-1,0,-1,-1,-1,-1,-1,-1,-1,1,1,-1,12,-1,-1,
+    -1,-1,2,-1,7,11,10,-1,-1,-1,-1,0,-1,3,-1,-1,
+    5,-1,-1,8,-1,4,4,-1,6,-1,7,1,-1,-1,2,9,
+};
+inline constexpr PrecompiledDFATable masterCombined = {64, 23, masterCombined_byteClass, masterCombined_transitions, masterCombined_accepting, masterCombined_acceptTag};
+
+} // namespace chessNotTables